@@ -0,0 +1,56 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef DRIVER_CDC200_H_
+#define DRIVER_CDC200_H_
+
+/*
+ * Host build subset of the Alif CDC200 display controller driver API.
+ * Implemented by host/mocks/mock_cdc200.c which captures the scanned out
+ * framebuffers to image files.
+ */
+#include "Driver_Common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CDC200 control codes */
+#define CDC200_CONFIGURE_DISPLAY       (0x01U)
+#define CDC200_FRAMEBUF_UPDATE         (0x02U)
+#define CDC200_SCANLINE0_EVENT         (0x03U)  /* arg: 1 enables, 0 disables the line interrupt */
+
+/* CDC200 events */
+#define ARM_CDC_SCANLINE0_EVENT        (1UL << 0)
+#define ARM_CDC_DSI_ERROR_EVENT        (1UL << 1)
+
+typedef void (*ARM_CDC200_SignalEvent_t)(uint32_t event);
+
+typedef struct _ARM_CDC200_CAPABILITIES {
+    uint32_t reentrant_operation : 1;
+    uint32_t dpi_interface       : 1;
+    uint32_t reserved            : 30;
+} ARM_CDC200_CAPABILITIES;
+
+typedef struct _ARM_DRIVER_CDC200 {
+    ARM_DRIVER_VERSION      (*GetVersion)(void);
+    ARM_CDC200_CAPABILITIES (*GetCapabilities)(void);
+    int32_t                 (*Initialize)(ARM_CDC200_SignalEvent_t cb_event);
+    int32_t                 (*Uninitialize)(void);
+    int32_t                 (*PowerControl)(ARM_POWER_STATE state);
+    int32_t                 (*Control)(uint32_t control, uintptr_t arg);
+    int32_t                 (*Start)(void);
+    int32_t                 (*Stop)(void);
+} const ARM_DRIVER_CDC200;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVER_CDC200_H_ */
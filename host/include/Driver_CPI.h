@@ -0,0 +1,72 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef DRIVER_CPI_H_
+#define DRIVER_CPI_H_
+
+/*
+ * Host build subset of the Alif CPI driver API.
+ * Implemented by host/mocks/mock_cpi.c which reads camera frames from a file.
+ */
+#include "Driver_Common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CPI control codes */
+#define CPI_CONFIGURE                  (0x01U)
+#define CPI_CAMERA_SENSOR_CONFIGURE    (0x02U)
+#define CPI_EVENTS_CONFIGURE           (0x03U)
+#define CPI_CAMERA_SENSOR_GAIN         (0x04U)
+
+/* ISP control codes */
+#define ISP_CONTROL_QBUF               (0x10U)
+#define ISP_PROCESS_FRAME_END          (0x11U)
+
+/* CPI events */
+#define ARM_CPI_EVENT_CAMERA_CAPTURE_STOPPED         (1UL << 0)
+#define ARM_CPI_EVENT_CAMERA_FRAME_HSYNC_DETECTED    (1UL << 1)
+#define ARM_CPI_EVENT_CAMERA_FRAME_VSYNC_DETECTED    (1UL << 2)
+#define ARM_CPI_EVENT_ERR_CAMERA_INPUT_FIFO_OVERRUN  (1UL << 3)
+#define ARM_CPI_EVENT_ERR_CAMERA_OUTPUT_FIFO_OVERRUN (1UL << 4)
+#define ARM_CPI_EVENT_ERR_HARDWARE                   (1UL << 5)
+#define ARM_CPI_EVENT_MIPI_CSI2_ERROR                (1UL << 6)
+
+/* ISP events */
+#define ARM_ISP_EVENT_FRAME_VSYNC_DETECTED           (1UL << 8)
+#define ARM_ISP_EVENT_FRAME_IN_DETECTED              (1UL << 9)
+#define ARM_ISP_MI_EVENT_MP_FRAME_END_DETECTED       (1UL << 10)
+#define ARM_ISP_MI_EVENT_FILL_MP_Y_DETECTED          (1UL << 11)
+#define ARM_ISP_MI_EVENT_MP_Y_WRAP_DETECTED          (1UL << 12)
+
+typedef void (*ARM_CPI_SignalEvent_t)(uint32_t event);
+
+typedef struct _ARM_CPI_CAPABILITIES {
+    uint32_t snapshot       : 1;
+    uint32_t reserved       : 31;
+} ARM_CPI_CAPABILITIES;
+
+typedef struct _ARM_DRIVER_CPI {
+    ARM_DRIVER_VERSION   (*GetVersion)(void);
+    ARM_CPI_CAPABILITIES (*GetCapabilities)(void);
+    int32_t              (*Initialize)(ARM_CPI_SignalEvent_t cb_event);
+    int32_t              (*Uninitialize)(void);
+    int32_t              (*PowerControl)(ARM_POWER_STATE state);
+    int32_t              (*CaptureFrame)(void *framebuffer_startaddr);
+    int32_t              (*CaptureVideo)(void *framebuffer_startaddr);
+    int32_t              (*Stop)(void);
+    int32_t              (*Control)(uint32_t control, uintptr_t arg);
+} const ARM_DRIVER_CPI;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVER_CPI_H_ */
@@ -0,0 +1,39 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef DRIVER_COMMON_H_
+#define DRIVER_COMMON_H_
+
+/* Host build subset of the CMSIS-Driver common definitions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define ARM_DRIVER_VERSION_MAJOR_MINOR(major, minor) (((major) << 8) | (minor))
+
+typedef struct _ARM_DRIVER_VERSION {
+    uint16_t api;
+    uint16_t drv;
+} ARM_DRIVER_VERSION;
+
+#define ARM_DRIVER_OK                 0
+#define ARM_DRIVER_ERROR             -1
+#define ARM_DRIVER_ERROR_BUSY        -2
+#define ARM_DRIVER_ERROR_TIMEOUT     -3
+#define ARM_DRIVER_ERROR_UNSUPPORTED -4
+#define ARM_DRIVER_ERROR_PARAMETER   -5
+#define ARM_DRIVER_ERROR_SPECIFIC    -6
+
+typedef enum _ARM_POWER_STATE {
+    ARM_POWER_OFF,
+    ARM_POWER_LOW,
+    ARM_POWER_FULL
+} ARM_POWER_STATE;
+
+#endif /* DRIVER_COMMON_H_ */
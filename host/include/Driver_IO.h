@@ -0,0 +1,58 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef DRIVER_IO_H_
+#define DRIVER_IO_H_
+
+/* Host build subset of the Alif GPIO driver API, see host/mocks/mock_board.c */
+#include "Driver_Common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define _ARM_Driver_GPIO_(n) Driver_GPIO##n
+#define ARM_Driver_GPIO_(n)  _ARM_Driver_GPIO_(n)
+
+typedef enum {
+    GPIO_PIN_DIRECTION_INPUT,
+    GPIO_PIN_DIRECTION_OUTPUT
+} GPIO_PIN_DIRECTION;
+
+typedef enum {
+    GPIO_PIN_OUTPUT_STATE_LOW,
+    GPIO_PIN_OUTPUT_STATE_HIGH,
+    GPIO_PIN_OUTPUT_STATE_TOGGLE
+} GPIO_PIN_OUTPUT_STATE;
+
+/* Control codes and interrupt configuration */
+#define ARM_GPIO_ENABLE_INTERRUPT           (1)
+#define ARM_GPIO_DISABLE_INTERRUPT          (2)
+#define ARM_GPIO_IRQ_POLARITY_LOW           (0)
+#define ARM_GPIO_IRQ_POLARITY_HIGH          (1U << 0)
+#define ARM_GPIO_IRQ_EDGE_SENSITIVE_SINGLE  (1U << 1)
+
+typedef void (*ARM_GPIO_SignalEvent_t)(uint32_t event);
+
+typedef struct _ARM_DRIVER_GPIO {
+    int32_t (*Initialize)(uint8_t pin_no, ARM_GPIO_SignalEvent_t cb_event);
+    int32_t (*PowerControl)(uint8_t pin_no, ARM_POWER_STATE state);
+    int32_t (*SetDirection)(uint8_t pin_no, uint32_t dir);
+    int32_t (*GetDirection)(uint8_t pin_no, uint32_t *dir);
+    int32_t (*SetValue)(uint8_t pin_no, uint32_t value);
+    int32_t (*GetValue)(uint8_t pin_no, uint32_t *value);
+    int32_t (*Control)(uint8_t pin_no, uint32_t control_code, uint32_t *arg);
+    int32_t (*Uninitialize)(uint8_t pin_no);
+} const ARM_DRIVER_GPIO;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVER_IO_H_ */
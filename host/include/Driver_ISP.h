@@ -0,0 +1,16 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef DRIVER_ISP_H_
+#define DRIVER_ISP_H_
+
+/* Host build: the ISP is driven through the mock CPI driver, see Driver_CPI.h */
+#include "Driver_CPI.h"
+
+#endif /* DRIVER_ISP_H_ */
@@ -0,0 +1,33 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef DRIVER_LPTIMER_H_
+#define DRIVER_LPTIMER_H_
+
+/* Host build subset of the Alif LPTIMER driver interface */
+#include <stdint.h>
+
+#include "Driver_Common.h"
+
+#define ARM_LPTIMER_SET_COUNT1      (1)
+#define ARM_LPTIMER_EVENT_UNDERFLOW (1)
+
+typedef void (*ARM_LPTIMER_SignalEvent_t)(uint8_t event);
+
+typedef struct _ARM_DRIVER_LPTIMER {
+    ARM_DRIVER_VERSION (*GetVersion)(void);
+    int32_t (*Initialize)(uint8_t channel, ARM_LPTIMER_SignalEvent_t cb_event);
+    int32_t (*PowerControl)(uint8_t channel, ARM_POWER_STATE state);
+    int32_t (*Control)(uint8_t channel, uint32_t control_code, void *arg);
+    int32_t (*Start)(uint8_t channel);
+    int32_t (*Stop)(uint8_t channel);
+    int32_t (*Uninitialize)(uint8_t channel);
+} ARM_DRIVER_LPTIMER;
+
+#endif /* DRIVER_LPTIMER_H_ */
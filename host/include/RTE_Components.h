@@ -0,0 +1,29 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef RTE_COMPONENTS_H
+#define RTE_COMPONENTS_H
+
+/*
+ * Host build replacement for the csolution generated RTE_Components.h.
+ * The camera sensor component is selected with VF_HOST_CAMERA in host/CMakeLists.txt.
+ */
+#define CMSIS_device_header "host_device.h"
+
+#if !defined(RTE_Drivers_CAMERA_SENSOR_MT9M114) && !defined(RTE_Drivers_CAMERA_SENSOR_ARX3A0) && \
+    !defined(RTE_Drivers_CAMERA_SENSOR_OV5675)
+#define RTE_Drivers_CAMERA_SENSOR_MT9M114
+#endif
+
+#define RTE_Drivers_MIPI_DSI_ILI9806E_PANEL
+#define RTE_Drivers_CDC200
+#define RTE_Drivers_CPI
+#define RTE_Drivers_IO
+
+#endif /* RTE_COMPONENTS_H */
@@ -0,0 +1,66 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef RTE_DEVICE_H
+#define RTE_DEVICE_H
+
+/*
+ * Host build replacement for RTE_Device.h.
+ * Only the options used by the viewfinder sources are defined. The values match
+ * the DevKit defaults and can be overridden from the compiler command line.
+ */
+
+/* ILI9806E panel (480x800) */
+#ifndef RTE_PANEL_HACTIVE_TIME
+#define RTE_PANEL_HACTIVE_TIME                         480
+#endif
+#ifndef RTE_PANEL_VACTIVE_LINE
+#define RTE_PANEL_VACTIVE_LINE                         800
+#endif
+#define RTE_PANEL_HSYNC_TIME                           4
+#define RTE_PANEL_HBP_TIME                             5
+#define RTE_PANEL_HFP_TIME                             5
+#define RTE_PANEL_VSYNC_LINE                           2
+#define RTE_PANEL_VBP_LINE                             10
+#define RTE_PANEL_VFP_LINE                             10
+
+/* CDC200: 0 = ARGB8888, 1 = RGB888, 2 = RGB565 */
+#ifndef RTE_CDC200_PIXEL_FORMAT
+#define RTE_CDC200_PIXEL_FORMAT                        2
+#endif
+#ifndef RTE_CDC200_DPI_FPS
+#define RTE_CDC200_DPI_FPS                             60
+#endif
+
+/* MT9M114: 1 = 1280x720 RAW8, 2 = 1280x720 RGB565, 3 = 640x480 RGB565 */
+#ifndef RTE_MT9M114_CAMERA_SENSOR_MIPI_IMAGE_CONFIG
+#define RTE_MT9M114_CAMERA_SENSOR_MIPI_IMAGE_CONFIG    1
+#endif
+
+#define RTE_ARX3A0_CAMERA_SENSOR_FRAME_WIDTH           560
+#define RTE_ARX3A0_CAMERA_SENSOR_FRAME_HEIGHT          560
+
+#define RTE_OV5675_CAMERA_SENSOR_FRAME_WIDTH           1296
+#define RTE_OV5675_CAMERA_SENSOR_FRAME_HEIGHT          972
+
+/* ISP (YUY2 output), enabled with -DRTE_ISP=1 */
+#ifndef RTE_ISP
+#define RTE_ISP                                        0
+#endif
+#if RTE_ISP
+#define RTE_CPI_AXI_PORT                               0
+#define RTE_ISP_OUTPUT_FORMAT                          32
+#define RTE_ISP_OUTPUT_WIDTH                           480
+#define RTE_ISP_OUTPUT_HEIGHT                          480
+#define RTE_ISP_BUFFER_COUNT                           1
+#else
+#define RTE_CPI_AXI_PORT                               1
+#endif
+
+#endif /* RTE_DEVICE_H */
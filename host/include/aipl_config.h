@@ -0,0 +1,21 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef HOST_AIPL_CONFIG_H
+#define HOST_AIPL_CONFIG_H
+
+/*
+ * Host build: reuse the application AIPL configuration from RTE/Graphics
+ * but build the portable C implementations instead of the Helium ones.
+ */
+#include_next <aipl_config.h>
+
+#undef AIPL_HELIUM_ACCELERATION
+
+#endif /* HOST_AIPL_CONFIG_H */
@@ -0,0 +1,43 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef AIPL_DAVE2D_H
+#define AIPL_DAVE2D_H
+
+/*
+ * Host build replacement for the AIPL D/AVE2D integration layer.
+ * Implemented on top of the mock D/AVE2D driver in host/mocks/mock_dave2d.c.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "aipl_image.h"
+#include "dave_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+d2_s32 aipl_dave2d_init(void);
+
+d2_device *aipl_dave2d_handle(void);
+
+bool aipl_dave2d_format_supported(aipl_color_format_t format);
+
+uint32_t aipl_dave2d_format_to_mode(aipl_color_format_t format);
+
+uint32_t aipl_dave2d_mode_px_size(uint32_t mode);
+
+bool aipl_dave2d_mode_has_alpha(uint32_t mode);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AIPL_DAVE2D_H */
@@ -0,0 +1,137 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef AIPM_H_
+#define AIPM_H_
+
+/*
+ * Host build subset of the Secure Enclave power management profile types.
+ * Field names and enumerators follow the Ensemble SE services aipm.h.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Power domains */
+#define PD_VBAT_AON_MASK        (1UL << 0)
+#define PD_SSE700_AON_MASK      (1UL << 1)
+#define PD_SYST_MASK            (1UL << 2)
+#define PD_SESS_MASK            (1UL << 3)
+#define PD_DBSS_MASK            (1UL << 4)
+
+/* Memory blocks */
+#define SERAM_MASK              (1UL << 0)
+#define SRAM0_MASK              (1UL << 1)
+#define SRAM1_MASK              (1UL << 2)
+#define MRAM_MASK               (1UL << 3)
+#define FWRAM_MASK              (1UL << 4)
+#define BACKUP4K_MASK           (1UL << 5)
+
+/* IP clock gating */
+#define CAMERA_MASK             (1UL << 0)
+#define MIPI_DSI_MASK           (1UL << 1)
+#define MIPI_CSI_MASK           (1UL << 2)
+#define CDC200_MASK             (1UL << 3)
+#define GPU_MASK                (1UL << 4)
+#define LP_PERIPH_MASK          (1UL << 5)
+
+/* PHY power gating */
+#define LDO_PHY_MASK            (1UL << 0)
+#define MIPI_TX_DPHY_MASK       (1UL << 1)
+#define MIPI_RX_DPHY_MASK       (1UL << 2)
+#define MIPI_PLL_DPHY_MASK      (1UL << 3)
+
+/* Wake up events */
+#define WE_LPGPIO               (1UL << 0)
+#define WE_LPTIMER              (1UL << 1)
+
+/* EWIC configuration */
+#define EWIC_VBAT_GPIO          (1UL << 0)
+#define EWIC_VBAT_TIMER         (1UL << 1)
+
+typedef enum {
+    DCDC_MODE_OFF,
+    DCDC_MODE_PFM_AUTO,
+    DCDC_MODE_PFM_FORCED,
+    DCDC_MODE_PWM
+} dcdc_mode_t;
+
+typedef enum {
+    CLK_SRC_LFRC,
+    CLK_SRC_LFXO,
+    CLK_SRC_HFRC,
+    CLK_SRC_HFXO,
+    CLK_SRC_PLL
+} clock_source_t;
+
+typedef enum {
+    IOFLEX_LEVEL_3V3,
+    IOFLEX_LEVEL_1V8
+} ioflex_mode_t;
+
+typedef enum {
+    CLOCK_FREQUENCY_800MHZ,
+    CLOCK_FREQUENCY_400MHZ,
+    CLOCK_FREQUENCY_300MHZ,
+    CLOCK_FREQUENCY_200MHZ,
+    CLOCK_FREQUENCY_160MHZ,
+    CLOCK_FREQUENCY_120MHZ,
+    CLOCK_FREQUENCY_80MHZ,
+    CLOCK_FREQUENCY_60MHZ,
+    CLOCK_FREQUENCY_100MHZ,
+    CLOCK_FREQUENCY_50MHZ,
+    CLOCK_FREQUENCY_20MHZ,
+    CLOCK_FREQUENCY_10MHZ,
+    CLOCK_FREQUENCY_76_8_RC_MHZ,
+    CLOCK_FREQUENCY_38_4_RC_MHZ,
+    CLOCK_FREQUENCY_76_8_XO_MHZ,
+    CLOCK_FREQUENCY_38_4_XO_MHZ,
+    CLOCK_FREQUENCY_DISABLED
+} clock_frequency_t;
+
+typedef enum {
+    SCALED_FREQ_RC_ACTIVE_76_8_MHZ,
+    SCALED_FREQ_RC_ACTIVE_38_4_MHZ,
+    SCALED_FREQ_RC_STDBY_76_8_MHZ,
+    SCALED_FREQ_RC_STDBY_38_4_MHZ,
+    SCALED_FREQ_XO_HIGH_DIV_38_4_MHZ,
+    SCALED_FREQ_XO_LOW_DIV_38_4_MHZ
+} scaled_clk_freq_t;
+
+typedef struct {
+    uint32_t power_domains;
+    uint32_t dcdc_voltage;
+    dcdc_mode_t dcdc_mode;
+    clock_source_t aon_clk_src;
+    clock_source_t run_clk_src;
+    clock_frequency_t cpu_clk_freq;
+    scaled_clk_freq_t scaled_clk_freq;
+    uint32_t memory_blocks;
+    uint32_t ip_clock_gating;
+    uint32_t phy_pwr_gating;
+    ioflex_mode_t vdd_ioflex_3V3;
+} run_profile_t;
+
+typedef struct {
+    uint32_t power_domains;
+    uint32_t dcdc_voltage;
+    dcdc_mode_t dcdc_mode;
+    clock_source_t aon_clk_src;
+    clock_source_t stby_clk_src;
+    scaled_clk_freq_t stby_clk_freq;
+    uint32_t memory_blocks;
+    uint32_t ip_clock_gating;
+    uint32_t phy_pwr_gating;
+    ioflex_mode_t vdd_ioflex_3V3;
+    uint32_t wakeup_events;
+    uint32_t ewic_cfg;
+    uint32_t vtor_address;
+    uint32_t vtor_address_ns;
+} off_profile_t;
+
+#endif /* AIPM_H_ */
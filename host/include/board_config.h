@@ -0,0 +1,23 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef BOARD_CONFIG_H_
+#define BOARD_CONFIG_H_
+
+/* Host build stand-in for the board configuration helpers */
+#include <stdint.h>
+
+#define CLKEN_HFOSC_MASK     (1UL << 0)
+#define CLKEN_CLK_100M_MASK  (1UL << 1)
+
+int32_t board_pins_config(void);
+int32_t board_gpios_config(void);
+int32_t board_clocks_config(uint32_t clocks);
+
+#endif /* BOARD_CONFIG_H_ */
@@ -0,0 +1,19 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef BOARD_DEFS_H_
+#define BOARD_DEFS_H_
+
+/* Host build board definitions: both LEDs are on the single mock GPIO port */
+#define BOARD_LEDRGB1_R_GPIO_PORT  0
+#define BOARD_LEDRGB1_R_GPIO_PIN   0
+#define BOARD_LEDRGB1_G_GPIO_PORT  0
+#define BOARD_LEDRGB1_G_GPIO_PIN   1
+
+#endif /* BOARD_DEFS_H_ */
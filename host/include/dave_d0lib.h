@@ -0,0 +1,24 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef DAVE_D0LIB_H_
+#define DAVE_D0LIB_H_
+
+/* Host build subset of the D/AVE d0lib video memory manager */
+#include <stddef.h>
+
+#define d0_mm_fixed_range  (1U)
+#define d0_ma_unified      (0U)
+
+int d0_initheapmanager(void *heap_start, size_t heap_size, unsigned int mode, void *rheap_start, size_t rheap_size,
+                       unsigned int min_size, unsigned int max_size, unsigned int align_mode);
+void *d0_allocvidmem(size_t size);
+void d0_freevidmem(void *ptr);
+
+#endif /* DAVE_D0LIB_H_ */
@@ -0,0 +1,105 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef DAVE_DRIVER_H_
+#define DAVE_DRIVER_H_
+
+/*
+ * Host build subset of the D/AVE2D driver API.
+ * host/mocks/mock_dave2d.c implements a software rasterizer for the
+ * texture mapped quads, clears and CLUT lookups used by the viewfinder.
+ */
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef int32_t  d2_s32;
+typedef uint32_t d2_u32;
+typedef int16_t  d2_s16;
+typedef uint16_t d2_u16;
+typedef uint8_t  d2_u8;
+typedef int32_t  d2_border;
+typedef int32_t  d2_point;
+typedef uint32_t d2_color;
+typedef uint8_t  d2_alpha;
+
+typedef void d2_device;
+typedef void d2_context;
+
+#define D2_OK          (0)
+#define D2_NOMEMORY    (1)
+#define D2_INVALIDDEVICE (2)
+#define D2_ILLEGALMODE (3)
+
+#define D2_FIX4(x)     ((x) << 4)
+#define D2_FIX16(x)    ((x) << 16)
+
+/* Color modes */
+#define d2_mode_alpha8     (0x00U)
+#define d2_mode_rgb565     (0x01U)
+#define d2_mode_argb8888   (0x02U)
+#define d2_mode_argb4444   (0x03U)
+#define d2_mode_rgb888     (0x04U)
+#define d2_mode_argb1555   (0x05U)
+#define d2_mode_rgba8888   (0x06U)
+#define d2_mode_rgba4444   (0x07U)
+#define d2_mode_rgba5551   (0x08U)
+#define d2_mode_i8         (0x09U)
+#define d2_mode_clut       (0x40U)
+
+/* Texture operations */
+#define d2_to_zero         (0U)
+#define d2_to_one          (1U)
+#define d2_to_replace      (2U)
+#define d2_to_copy         (3U)
+#define d2_to_invert       (4U)
+
+/* Texture modes */
+#define d2_tm_filter       (0x03U)
+
+/* Fill modes */
+#define d2_fm_color        (0U)
+#define d2_fm_texture      (1U)
+
+/* Blend factors */
+#define d2_bm_zero                (0U)
+#define d2_bm_one                 (1U)
+#define d2_bm_alpha               (2U)
+#define d2_bm_one_minus_alpha     (3U)
+
+d2_s32 d2_framebuffer(d2_device *handle, void *ptr, d2_s32 pitch, d2_u32 width, d2_u32 height, d2_s32 format);
+d2_s32 d2_clear(d2_device *handle, d2_color color);
+d2_s32 d2_startframe(d2_device *handle);
+d2_s32 d2_endframe(d2_device *handle);
+d2_s32 d2_flushframe(d2_device *handle);
+d2_s32 d2_cliprect(d2_device *handle, d2_border xmin, d2_border ymin, d2_border xmax, d2_border ymax);
+d2_s32 d2_settextureoperation(d2_device *handle, d2_u8 amode, d2_u8 rmode, d2_u8 gmode, d2_u8 bmode);
+d2_s32 d2_settexture(d2_device *handle, void *ptr, d2_s32 pitch, d2_s32 width, d2_s32 height, d2_u32 format);
+d2_s32 d2_settexturemode(d2_device *handle, d2_u32 mode);
+d2_s32 d2_setfillmode(d2_device *handle, d2_u8 mode);
+d2_s32 d2_setblendmode(d2_device *handle, d2_u32 srcfactor, d2_u32 dstfactor);
+d2_s32 d2_setalphablendmode(d2_device *handle, d2_u32 srcfactor, d2_u32 dstfactor);
+d2_s32 d2_settexturemapping(d2_device *handle, d2_point x, d2_point y, d2_s32 u0, d2_s32 v0,
+                            d2_s32 dxu, d2_s32 dxv, d2_s32 dyu, d2_s32 dyv);
+d2_s32 d2_renderquad(d2_device *handle, d2_point x1, d2_point y1, d2_point x2, d2_point y2,
+                     d2_point x3, d2_point y3, d2_point x4, d2_point y4, d2_u32 flags);
+d2_context *d2_newcontext(d2_device *handle);
+d2_s32 d2_freecontext(d2_device *handle, d2_context *ctx);
+d2_s32 d2_selectcontext(d2_device *handle, d2_context *ctx);
+d2_context *d2_getcontext(d2_device *handle, d2_s32 index);  /* -1: selected context */
+d2_s32 d2_settexclut(d2_device *handle, d2_color *clut);
+d2_s32 d2_settexclut_format(d2_device *handle, d2_u32 format);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DAVE_DRIVER_H_ */
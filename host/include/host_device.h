@@ -0,0 +1,120 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef HOST_DEVICE_H_
+#define HOST_DEVICE_H_
+
+/*
+ * Host build replacement for the CMSIS device header (alif.h).
+ * Provides the core intrinsics, cache maintenance and PMU cycle counter
+ * used by the viewfinder sources. Interrupts are simulated: mock drivers
+ * post events with host_irq_post() and they are delivered from __WFI().
+ * Free-running sources such as the display line interrupt use
+ * host_irq_post_background(), they alone do not keep the application running.
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "RTE_Device.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Simulated interrupt handler, called from __WFI() context */
+typedef void (*host_irq_handler_t)(void *ctx);
+
+/* Queue a simulated interrupt, delivered on the next __WFI() */
+void host_irq_post(host_irq_handler_t handler, void *ctx);
+
+/* Queue an interrupt of a free-running source. The application is idle once
+ * only these wake it up for a long run of __WFI() calls */
+void host_irq_post_background(host_irq_handler_t handler, void *ctx);
+
+/* Deliver pending interrupts; exits the process if none are pending */
+void host_wfi(void);
+
+/* Stop on a breakpoint; prints the location and exits with an error */
+void host_bkpt(int value, const char *file, int line);
+
+/* Set the process exit status used when the application goes idle (default 0,
+ * or 1 once the red error LED has been switched on) */
+void host_set_exit_status(int status);
+
+/* Emulated PMU cycle counter at the nominal core clock */
+uint32_t host_pmu_get_ccntr(void);
+void host_pmu_reset_ccntr(void);
+
+#define __BKPT(value)   host_bkpt((value), __FILE__, __LINE__)
+#define __WFI()         host_wfi()
+#define __WFE()         host_wfi()
+#define __SEV()         ((void)0)
+#define __NOP()         ((void)0)
+#define __DSB()         __sync_synchronize()
+#define __DMB()         __sync_synchronize()
+#define __ISB()         __sync_synchronize()
+#define __enable_irq()  ((void)0)
+#define __disable_irq() ((void)0)
+
+/* Cache maintenance is a no-op on the host */
+#define SCB_CleanDCache()                              ((void)0)
+#define SCB_InvalidateDCache()                         ((void)0)
+#define SCB_CleanInvalidateDCache()                    ((void)0)
+#define SCB_CleanDCache_by_Addr(addr, size)            ((void)(addr), (void)(size))
+#define SCB_InvalidateDCache_by_Addr(addr, size)       ((void)(addr), (void)(size))
+#define SCB_CleanInvalidateDCache_by_Addr(addr, size)  ((void)(addr), (void)(size))
+#define RTSS_CleanDCache_by_Addr(addr, size)           ((void)(addr), (void)(size))
+#define RTSS_InvalidateDCache_by_Addr(addr, size)      ((void)(addr), (void)(size))
+
+/* Debug control block, only DEMCR.TRCENA is used */
+typedef struct {
+    volatile uint32_t DEMCR;
+} DCB_Type;
+extern DCB_Type host_dcb;
+#define DCB                         (&host_dcb)
+#define DCB_DEMCR_TRCENA_Msk        (1UL << 24)
+
+/* SysTick, clk_init() enables it as the clock() time base */
+typedef struct {
+    volatile uint32_t CTRL;
+    volatile uint32_t LOAD;
+    volatile uint32_t VAL;
+} SysTick_Type;
+extern SysTick_Type host_systick;
+#define SysTick                     (&host_systick)
+#define SysTick_CTRL_ENABLE_Msk     (1UL << 0)
+#define SysTick_CTRL_TICKINT_Msk    (1UL << 1)
+
+/* PMU cycle counter */
+#define PMU_CNTENSET_CCNTR_ENABLE_Msk (1UL << 31)
+#define ARM_PMU_Enable()              ((void)0)
+#define ARM_PMU_CNTR_Enable(mask)     ((void)(mask))
+#define ARM_PMU_CYCCNT_Reset()        host_pmu_reset_ccntr()
+#define ARM_PMU_Get_CCNTR()           host_pmu_get_ccntr()
+
+extern uint32_t SystemCoreClock;
+
+/* Backup SRAM, kept by the mock across the emulated subsystem off state */
+extern uint8_t host_backup_ram[4096];
+#define STANDBY_STATE_ADDR ((uintptr_t)host_backup_ram)
+
+/* Last 4 KB of the application MRAM, loaded from and saved to VF_HOST_MRAM */
+extern uint8_t host_mram_record[4096];
+#define AUTOTUNE_RECORD_ADDR ((uintptr_t)host_mram_record)
+
+/* CDC200 display controller registers (display/cdc200_regs.h), modelled by host/mocks/mock_cdc200.c */
+extern uint32_t host_cdc200_regs[];
+#define CDC_BASE ((uintptr_t)host_cdc200_regs)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_DEVICE_H_ */
@@ -0,0 +1,21 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef PM_H_
+#define PM_H_
+
+/* Host build subset of the Alif core power management API */
+
+/* Deep sleep of the core, the subsystem stays on and any enabled interrupt wakes the core up */
+void pm_core_enter_deep_sleep(void);
+
+/* Request the subsystem off state, the SE applies the off profile and the core restarts from reset on wake-up */
+void pm_core_enter_deep_sleep_request_subsys_off(void);
+
+#endif /* PM_H_ */
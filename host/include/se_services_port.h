@@ -0,0 +1,20 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef SE_SERVICES_PORT_H_
+#define SE_SERVICES_PORT_H_
+
+/* Host build stand-in for the Secure Enclave services port */
+#include <stdint.h>
+
+extern uint32_t se_services_s_handle;
+
+void se_services_port_init(void);
+
+#endif /* SE_SERVICES_PORT_H_ */
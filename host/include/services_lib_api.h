@@ -0,0 +1,26 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef SERVICES_LIB_API_H_
+#define SERVICES_LIB_API_H_
+
+/*
+ * Host build subset of the Secure Enclave services API.
+ * The mock keeps the last applied profiles so they can be inspected.
+ */
+#include <stdint.h>
+
+#include "aipm.h"
+
+uint32_t SERVICES_set_run_cfg(uint32_t services_handle, run_profile_t *pp, uint32_t *error_code);
+uint32_t SERVICES_get_run_cfg(uint32_t services_handle, run_profile_t *pp, uint32_t *error_code);
+uint32_t SERVICES_set_off_cfg(uint32_t services_handle, off_profile_t *wp, uint32_t *error_code);
+uint32_t SERVICES_get_off_cfg(uint32_t services_handle, off_profile_t *wp, uint32_t *error_code);
+
+#endif /* SERVICES_LIB_API_H_ */
@@ -0,0 +1,15 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef SERVICES_LIB_BARE_METAL_H_
+#define SERVICES_LIB_BARE_METAL_H_
+
+/* Host build: nothing to port for the bare metal services transport */
+
+#endif /* SERVICES_LIB_BARE_METAL_H_ */
@@ -0,0 +1,20 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef UART_TRACELIB_H_
+#define UART_TRACELIB_H_
+
+/* Host build: trace output goes to stdout */
+#include <stdint.h>
+
+typedef void (*uart_callback_t)(uint32_t event);
+
+int tracelib_init(const char *prefix, uart_callback_t callback);
+
+#endif /* UART_TRACELIB_H_ */
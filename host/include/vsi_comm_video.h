@@ -0,0 +1,29 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef VSI_COMM_VIDEO_H_
+#define VSI_COMM_VIDEO_H_
+
+/* Host build subset of the VSI ISP video buffer descriptor */
+#include <stdint.h>
+
+typedef uintptr_t vsi_dma_t;
+
+typedef struct {
+    vsi_dma_t dmaPhyAddr;
+} VIDEO_PLANE_S;
+
+typedef struct {
+    uint32_t index;
+    uint32_t numPlanes;
+    uint32_t imageSize;
+    VIDEO_PLANE_S planes[3];
+} VIDEO_BUF_S;
+
+#endif /* VSI_COMM_VIDEO_H_ */
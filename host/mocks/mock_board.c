@@ -0,0 +1,317 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/*
+ * Host build board support: simulated interrupts, PMU cycle counter,
+ * GPIO, board configuration and Secure Enclave services stand-ins.
+ *
+ * The application MRAM record area is kept in the file named by VF_HOST_MRAM,
+ * loaded at start and saved at exit like the MRAM keeps it across resets.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+#include "Driver_IO.h"
+#include "board_defs.h"
+#include "board_config.h"
+#include "se_services_port.h"
+#include "services_lib_api.h"
+#include "uart_tracelib.h"
+
+#define HOST_IRQ_QUEUE_LEN (16)
+#define HOST_SYSTICK_HZ    (1000)
+// __WFI() calls woken up only by background interrupts before the application counts as idle
+#define HOST_BACKGROUND_WFI_LIMIT (4096)
+
+#if defined(CORE_M55_HE)
+#define HOST_NOMINAL_CLOCK (160000000)
+#else
+#define HOST_NOMINAL_CLOCK (400000000)
+#endif
+
+uint32_t SystemCoreClock = HOST_NOMINAL_CLOCK;
+
+DCB_Type host_dcb;
+SysTick_Type host_systick;
+uint32_t se_services_s_handle;
+uint8_t host_mram_record[4096] __attribute__((aligned(16)));
+
+static struct {
+    host_irq_handler_t handler;
+    void *ctx;
+    bool background;
+} irq_queue[HOST_IRQ_QUEUE_LEN];
+static uint32_t irq_head;
+static uint32_t irq_tail;
+static uint32_t background_wfis;
+
+// Exit status once the application goes idle, -1 until an outcome is known
+static int exit_status = -1;
+static uint64_t pmu_base_ns;
+static uint32_t led_state;
+
+static run_profile_t host_run_profile;
+static off_profile_t host_off_profile;
+
+__attribute__((constructor)) static void host_mram_load(void) {
+    const char *path = getenv("VF_HOST_MRAM");
+    FILE *f = path ? fopen(path, "rb") : NULL;
+    if (f) {
+        if (fread(host_mram_record, 1, sizeof(host_mram_record), f) != sizeof(host_mram_record)) {
+            memset(host_mram_record, 0xFF, sizeof(host_mram_record));
+        }
+        fclose(f);
+    } else {
+        // Erased MRAM
+        memset(host_mram_record, 0xFF, sizeof(host_mram_record));
+    }
+}
+
+__attribute__((destructor)) static void host_mram_save(void) {
+    const char *path = getenv("VF_HOST_MRAM");
+    if (path == NULL) {
+        return;
+    }
+    FILE *f = fopen(path, "wb");
+    if (f == NULL || fwrite(host_mram_record, 1, sizeof(host_mram_record), f) != sizeof(host_mram_record)) {
+        fprintf(stderr, "host: cannot save MRAM to %s\n", path);
+    }
+    if (f) {
+        fclose(f);
+    }
+}
+
+static uint64_t host_time_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/*
+ * clock() of the target retarget layer counts SysTick interrupts, i.e. wall
+ * time. Replaces the C library clock() (process CPU time) so that sleeping
+ * in __WFI() advances it.
+ */
+static uint64_t clock_base_ns;
+static bool clock_polled;
+
+clock_t clock(void) {
+    clock_polled = true;
+    return (clock_t)((host_time_ns() - clock_base_ns) / (1000000000ULL / CLOCKS_PER_SEC));
+}
+
+/* Simulated interrupts */
+static void irq_post(host_irq_handler_t handler, void *ctx, bool background) {
+    if (irq_tail - irq_head >= HOST_IRQ_QUEUE_LEN) {
+        fprintf(stderr, "host: interrupt queue overflow\n");
+        exit(3);
+    }
+    irq_queue[irq_tail % HOST_IRQ_QUEUE_LEN].handler = handler;
+    irq_queue[irq_tail % HOST_IRQ_QUEUE_LEN].ctx = ctx;
+    irq_queue[irq_tail % HOST_IRQ_QUEUE_LEN].background = background;
+    irq_tail++;
+}
+
+void host_irq_post(host_irq_handler_t handler, void *ctx) {
+    irq_post(handler, ctx, false);
+}
+
+void host_irq_post_background(host_irq_handler_t handler, void *ctx) {
+    irq_post(handler, ctx, true);
+}
+
+void host_wfi(void) {
+    bool background_only = true;
+    for (uint32_t i = irq_head; i != irq_tail; i++) {
+        background_only = background_only && irq_queue[i % HOST_IRQ_QUEUE_LEN].background;
+    }
+
+    if (!background_only) {
+        background_wfis = 0;
+    } else if (clock_polled) {
+        // Waiting for a point in time: sleep until the next SysTick
+        clock_polled = false;
+        background_wfis = 0;
+        struct timespec tick = { 0, 1000000000L / HOST_SYSTICK_HZ };
+        nanosleep(&tick, NULL);
+    } else if (irq_head == irq_tail || ++background_wfis > HOST_BACKGROUND_WFI_LIMIT) {
+        // Nothing but free-running sources can wake the core up anymore, the application is done
+        fflush(stdout);
+        exit(exit_status < 0 ? 0 : exit_status);
+    }
+
+    // Interrupts a handler posts come with the next __WFI()
+    uint32_t tail = irq_tail;
+    while (irq_head != tail) {
+        uint32_t slot = irq_head % HOST_IRQ_QUEUE_LEN;
+        irq_head++;
+        irq_queue[slot].handler(irq_queue[slot].ctx);
+    }
+}
+
+void host_bkpt(int value, const char *file, int line) {
+    fflush(stdout);
+    fprintf(stderr, "host: __BKPT(%d) at %s:%d\n", value, file, line);
+    exit(2);
+}
+
+void host_set_exit_status(int status) {
+    exit_status = status;
+}
+
+/*
+ * PMU cycle counter. The host does not slow down when the application lowers
+ * the clock, so cycles are counted at the nominal clock: the cycle count of a
+ * piece of work stays the same and the time derived from SystemCoreClock grows,
+ * as it would on target.
+ */
+uint32_t host_pmu_get_ccntr(void) {
+    uint64_t ns = host_time_ns() - pmu_base_ns;
+    return (uint32_t)(ns * HOST_NOMINAL_CLOCK / 1000000000ULL);
+}
+
+void host_pmu_reset_ccntr(void) {
+    pmu_base_ns = host_time_ns();
+}
+
+/* GPIO (LEDs) */
+static int32_t gpio_initialize(uint8_t pin_no, ARM_GPIO_SignalEvent_t cb_event) {
+    (void)pin_no;
+    (void)cb_event;
+    return ARM_DRIVER_OK;
+}
+
+static int32_t gpio_power_control(uint8_t pin_no, ARM_POWER_STATE state) {
+    (void)pin_no;
+    (void)state;
+    return ARM_DRIVER_OK;
+}
+
+static int32_t gpio_set_direction(uint8_t pin_no, uint32_t dir) {
+    (void)pin_no;
+    (void)dir;
+    return ARM_DRIVER_OK;
+}
+
+static int32_t gpio_get_direction(uint8_t pin_no, uint32_t *dir) {
+    (void)pin_no;
+    *dir = GPIO_PIN_DIRECTION_OUTPUT;
+    return ARM_DRIVER_OK;
+}
+
+static int32_t gpio_set_value(uint8_t pin_no, uint32_t value) {
+    if (value == GPIO_PIN_OUTPUT_STATE_TOGGLE) {
+        led_state ^= (1U << pin_no);
+    } else if (value == GPIO_PIN_OUTPUT_STATE_HIGH) {
+        led_state |= (1U << pin_no);
+        // The application sets the red LED on error, unless the input simply ran out
+        if (pin_no == BOARD_LEDRGB1_R_GPIO_PIN && exit_status < 0) {
+            exit_status = 1;
+        }
+    } else {
+        led_state &= ~(1U << pin_no);
+    }
+    return ARM_DRIVER_OK;
+}
+
+static int32_t gpio_get_value(uint8_t pin_no, uint32_t *value) {
+    *value = (led_state >> pin_no) & 1U;
+    return ARM_DRIVER_OK;
+}
+
+static int32_t gpio_control(uint8_t pin_no, uint32_t control_code, uint32_t *arg) {
+    (void)pin_no;
+    (void)control_code;
+    (void)arg;
+    return ARM_DRIVER_OK;
+}
+
+static int32_t gpio_uninitialize(uint8_t pin_no) {
+    (void)pin_no;
+    return ARM_DRIVER_OK;
+}
+
+ARM_DRIVER_GPIO Driver_GPIO0 = {
+    gpio_initialize, gpio_power_control, gpio_set_direction, gpio_get_direction,
+    gpio_set_value,  gpio_get_value,     gpio_control,       gpio_uninitialize,
+};
+
+/* Board configuration */
+int32_t board_pins_config(void) {
+    return 0;
+}
+
+int32_t board_gpios_config(void) {
+    return 0;
+}
+
+int32_t board_clocks_config(uint32_t clocks) {
+    (void)clocks;
+    return 0;
+}
+
+/* Secure Enclave services */
+void se_services_port_init(void) {
+    se_services_s_handle = 1;
+}
+
+uint32_t SERVICES_set_run_cfg(uint32_t services_handle, run_profile_t *pp, uint32_t *error_code) {
+    (void)services_handle;
+    host_run_profile = *pp;
+    *error_code = 0;
+    return 0;
+}
+
+uint32_t SERVICES_get_run_cfg(uint32_t services_handle, run_profile_t *pp, uint32_t *error_code) {
+    (void)services_handle;
+    *pp = host_run_profile;
+    *error_code = 0;
+    return 0;
+}
+
+uint32_t SERVICES_set_off_cfg(uint32_t services_handle, off_profile_t *wp, uint32_t *error_code) {
+    (void)services_handle;
+    host_off_profile = *wp;
+    *error_code = 0;
+    return 0;
+}
+
+uint32_t SERVICES_get_off_cfg(uint32_t services_handle, off_profile_t *wp, uint32_t *error_code) {
+    (void)services_handle;
+    *wp = host_off_profile;
+    *error_code = 0;
+    return 0;
+}
+
+/* The SysTick interrupt of the retarget layer, clock() above follows host time and needs no ticks */
+void SysTick_Handler(void) {
+}
+
+/* Logging and time */
+int tracelib_init(const char *prefix, uart_callback_t callback) {
+    (void)prefix;
+    (void)callback;
+    setvbuf(stdout, NULL, _IOLBF, 0);
+    return 0;
+}
+
+void clk_init(void) {
+    clock_base_ns = host_time_ns();
+    host_systick.LOAD = SystemCoreClock / HOST_SYSTICK_HZ - 1;
+    host_systick.CTRL = SysTick_CTRL_ENABLE_Msk;
+    host_pmu_reset_ccntr();
+}
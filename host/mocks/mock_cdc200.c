@@ -0,0 +1,224 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/*
+ * Host build CDC200 display controller mock.
+ *
+ * Each framebuffer handed to the controller with CDC200_FRAMEBUF_UPDATE is
+ * what the panel would scan out next. When the VF_HOST_OUTPUT environment
+ * variable names a directory, every such frame is written there as a binary
+ * PPM image (frame_00000.ppm, frame_00001.ppm, ...).
+ *
+ * The registers of display/cdc200_regs.h that the application programs
+ * directly are a plain memory block. A shadow reload requested in it loads
+ * the layer 2 registers at the next frame, an enabled ARGB4444 layer 2 is
+ * then blended over the framebuffer with its pixel and constant alpha.
+ *
+ * The beam has no timing: while the line interrupt is enabled it reaches the
+ * line in the LINE_IRQ_POSITION register at every __WFI(), unless the line is
+ * past the end of the scan-out. The drawing of an application racing the beam
+ * never misses a deadline on the host.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+#include "Driver_CDC200.h"
+#include "RTE_Device.h"
+#include "cdc200_regs.h"
+
+uint32_t host_cdc200_regs[sizeof(cdc200_regs_t) / sizeof(uint32_t)] __attribute__((aligned(8)));
+
+static ARM_CDC200_SignalEvent_t cdc_cb;
+static const uint8_t *cdc_framebuffer;
+static bool cdc_started;
+static uint32_t cdc_frame_count;
+static cdc200_layer_regs_t cdc_layer2;  // Layer 2 registers loaded by the last shadow reload
+static bool cdc_line_irq_on;
+static bool cdc_line_irq_pending;
+
+static void rgb_from_pixel(const uint8_t *px, uint8_t *rgb) {
+#if RTE_CDC200_PIXEL_FORMAT == 0  // ARGB8888
+    uint32_t c = px[0] | (px[1] << 8) | (px[2] << 16) | ((uint32_t)px[3] << 24);
+    rgb[0] = (uint8_t)(c >> 16);
+    rgb[1] = (uint8_t)(c >> 8);
+    rgb[2] = (uint8_t)c;
+#elif RTE_CDC200_PIXEL_FORMAT == 1  // RGB888
+    rgb[0] = px[2];
+    rgb[1] = px[1];
+    rgb[2] = px[0];
+#elif RTE_CDC200_PIXEL_FORMAT == 2  // RGB565
+    uint16_t c = (uint16_t)(px[0] | (px[1] << 8));
+    rgb[0] = (uint8_t)(((c >> 11) & 0x1F) * 255 / 31);
+    rgb[1] = (uint8_t)(((c >> 5) & 0x3F) * 255 / 63);
+    rgb[2] = (uint8_t)((c & 0x1F) * 255 / 31);
+#else
+#error "CDC200 Unsupported color format"
+#endif
+}
+
+// Load the shadowed layer 2 registers in the vertical blanking before the frame, returns whether layer 2 is shown
+static bool reload_overlay(void) {
+    cdc200_regs_t *regs = CDC200_REGS;
+    if (regs->SHADOW_RELOAD) {
+        cdc_layer2 = regs->LAYER[1];
+        regs->SHADOW_RELOAD = 0;
+    }
+    if (!(cdc_layer2.CONTROL & CDC200_LAYER_ENABLE)) {
+        return false;
+    }
+
+    // Only an ARGB4444 layer inside the active area, blended with its pixel alpha, is modelled
+    uint32_t x0 = cdc_layer2.WINDOW_H & 0xFFFF;
+    uint32_t x1 = cdc_layer2.WINDOW_H >> 16;
+    uint32_t y0 = cdc_layer2.WINDOW_V & 0xFFFF;
+    uint32_t y1 = cdc_layer2.WINDOW_V >> 16;
+    uint32_t width = x1 + 1 - x0;
+    if (cdc_layer2.PIXEL_FORMAT != CDC200_LAYER_FORMAT_ARGB4444 || cdc_layer2.BLEND != CDC200_BLEND_PIXEL_ALPHA ||
+        cdc_layer2.CFB_ADDR == 0 || x0 < CDC200_FIRST_ACTIVE_COLUMN || x1 < x0 ||
+        x1 >= CDC200_FIRST_ACTIVE_COLUMN + RTE_PANEL_HACTIVE_TIME || y0 < CDC200_FIRST_ACTIVE_LINE || y1 < y0 ||
+        y1 >= CDC200_FIRST_ACTIVE_LINE + RTE_PANEL_VACTIVE_LINE ||
+        cdc_layer2.CFB_LENGTH != CDC200_CFB_LENGTH(width * 2, width * 2) || cdc_layer2.CFB_LINES != y1 + 1 - y0) {
+        fprintf(stderr, "mock_cdc200: layer 2 configuration is not supported\n");
+        return false;
+    }
+    return true;
+}
+
+// Layer 2 over the layer 1 pixel at x, y of the active area
+static void blend_overlay(uint32_t x, uint32_t y, uint8_t *rgb) {
+    x += CDC200_FIRST_ACTIVE_COLUMN;
+    y += CDC200_FIRST_ACTIVE_LINE;
+    uint32_t x0 = cdc_layer2.WINDOW_H & 0xFFFF;
+    uint32_t y0 = cdc_layer2.WINDOW_V & 0xFFFF;
+    if (x < x0 || y < y0 || x > cdc_layer2.WINDOW_H >> 16 || y > cdc_layer2.WINDOW_V >> 16) {
+        return;
+    }
+    const uint8_t *line = (const uint8_t *)cdc_layer2.CFB_ADDR + (y - y0) * (cdc_layer2.CFB_LENGTH >> 16);
+    uint16_t c = ((const uint16_t *)line)[x - x0];
+    uint32_t a = ((c >> 12) & 0xF) * 17 * (cdc_layer2.CONST_ALPHA & 0xFF) / 255;
+    for (int i = 0; i < 3; i++) {
+        uint32_t v = ((c >> (8 - 4 * i)) & 0xF) * 17;
+        rgb[i] = (uint8_t)((v * a + rgb[i] * (255 - a) + 127) / 255);
+    }
+}
+
+static void dump_framebuffer(const uint8_t *fb) {
+    const char *out_dir = getenv("VF_HOST_OUTPUT");
+    if (out_dir == NULL || out_dir[0] == '\0' || fb == NULL) {
+        return;
+    }
+
+    char path[512];
+    snprintf(path, sizeof(path), "%s/frame_%05u.ppm", out_dir, cdc_frame_count);
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        fprintf(stderr, "mock_cdc200: cannot write %s\n", path);
+        return;
+    }
+
+    static const uint32_t bpp[] = {4, 3, 2};
+    bool overlay = reload_overlay();
+    fprintf(f, "P6\n%d %d\n255\n", RTE_PANEL_HACTIVE_TIME, RTE_PANEL_VACTIVE_LINE);
+    for (uint32_t i = 0; i < RTE_PANEL_HACTIVE_TIME * RTE_PANEL_VACTIVE_LINE; i++) {
+        uint8_t rgb[3];
+        rgb_from_pixel(fb + i * bpp[RTE_CDC200_PIXEL_FORMAT], rgb);
+        if (overlay) {
+            blend_overlay(i % RTE_PANEL_HACTIVE_TIME, i / RTE_PANEL_HACTIVE_TIME, rgb);
+        }
+        fwrite(rgb, 1, sizeof(rgb), f);
+    }
+    fclose(f);
+}
+
+static void cdc_post_line_irq(void);
+
+static void cdc_line_irq(void *ctx) {
+    (void)ctx;
+    cdc_line_irq_pending = false;
+    if (CDC200_REGS->LINE_IRQ_POSITION >= RTE_PANEL_VACTIVE_LINE + RTE_PANEL_VFP_LINE + RTE_PANEL_VSYNC_LINE +
+                                              RTE_PANEL_VBP_LINE) {
+        return;  // The beam never reaches the line
+    }
+    if (cdc_line_irq_on && cdc_cb) {
+        cdc_cb(ARM_CDC_SCANLINE0_EVENT);
+    }
+    cdc_post_line_irq();
+}
+
+// The beam reaches the line at the next __WFI(), a free-running source
+static void cdc_post_line_irq(void) {
+    if (cdc_line_irq_on && !cdc_line_irq_pending) {
+        cdc_line_irq_pending = true;
+        host_irq_post_background(cdc_line_irq, NULL);
+    }
+}
+
+static ARM_DRIVER_VERSION cdc_get_version(void) {
+    ARM_DRIVER_VERSION version = {ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0), ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0)};
+    return version;
+}
+
+static ARM_CDC200_CAPABILITIES cdc_get_capabilities(void) {
+    ARM_CDC200_CAPABILITIES caps = {.dpi_interface = 1};
+    return caps;
+}
+
+static int32_t cdc_initialize(ARM_CDC200_SignalEvent_t cb_event) {
+    cdc_cb = cb_event;
+    return ARM_DRIVER_OK;
+}
+
+static int32_t cdc_uninitialize(void) {
+    cdc_cb = NULL;
+    return ARM_DRIVER_OK;
+}
+
+static int32_t cdc_power_control(ARM_POWER_STATE state) {
+    (void)state;
+    return ARM_DRIVER_OK;
+}
+
+static int32_t cdc_control(uint32_t control, uintptr_t arg) {
+    switch (control) {
+        case CDC200_CONFIGURE_DISPLAY:
+            cdc_framebuffer = (const uint8_t *)arg;
+            return ARM_DRIVER_OK;
+        case CDC200_FRAMEBUF_UPDATE:
+            cdc_framebuffer = (const uint8_t *)arg;
+            if (cdc_started) {
+                dump_framebuffer(cdc_framebuffer);
+                cdc_frame_count++;
+            }
+            return ARM_DRIVER_OK;
+        case CDC200_SCANLINE0_EVENT:
+            cdc_line_irq_on = arg != 0;
+            cdc_post_line_irq();
+            return ARM_DRIVER_OK;
+        default:
+            return ARM_DRIVER_ERROR_UNSUPPORTED;
+    }
+}
+
+static int32_t cdc_start(void) {
+    cdc_started = true;
+    return ARM_DRIVER_OK;
+}
+
+static int32_t cdc_stop(void) {
+    cdc_started = false;
+    return ARM_DRIVER_OK;
+}
+
+ARM_DRIVER_CDC200 Driver_CDC200 = {
+    cdc_get_version, cdc_get_capabilities, cdc_initialize, cdc_uninitialize,
+    cdc_power_control, cdc_control, cdc_start, cdc_stop,
+};
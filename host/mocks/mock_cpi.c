@@ -0,0 +1,207 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/*
+ * Host build CPI (and ISP) driver mock.
+ *
+ * Every CaptureFrame() reads the next raw frame from the file named by the
+ * VF_HOST_INPUT environment variable into the capture buffer, or into the first
+ * queued ISP buffer when the ISP is enabled. The file holds one or more frames
+ * back to back in the sensor output format (Bayer, RGB565 or YUY2 for the ISP).
+ * Without an input file a synthetic ramp is generated instead.
+ *
+ * VF_HOST_FRAMES limits the number of captured frames and VF_HOST_LOOP=1
+ * restarts the input file after the last frame. Once the input is exhausted
+ * CaptureFrame() fails, which ends the application main loop.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Driver_CPI.h"
+#include "camera.h"
+
+#if RTE_ISP
+#include "vsi_comm_video.h"
+#endif
+
+#if RTE_ISP
+#define MOCK_FRAME_SIZE   (RTE_ISP_OUTPUT_WIDTH * RTE_ISP_OUTPUT_HEIGHT * 2)
+#define MOCK_FRAME_EVENT  ARM_ISP_MI_EVENT_MP_FRAME_END_DETECTED
+#else
+#define MOCK_FRAME_SIZE   (CAM_FRAME_SIZE * (CAM_USE_RGB565 ? 2 : 1))
+#define MOCK_FRAME_EVENT  ARM_CPI_EVENT_CAMERA_CAPTURE_STOPPED
+#endif
+
+#define MOCK_DEFAULT_SYNTHETIC_FRAMES (10)
+
+static ARM_CPI_SignalEvent_t cpi_cb;
+static uint32_t cpi_event_mask;
+static uint32_t cpi_pending_event;
+static bool cpi_powered;
+
+static FILE *input_file;
+static uint32_t frame_limit;
+static uint32_t frame_count;
+static bool loop_input;
+
+#if RTE_ISP
+static VIDEO_BUF_S *isp_queue[RTE_ISP_BUFFER_COUNT];
+static uint32_t isp_queued;
+#endif
+
+static void cpi_irq(void *ctx) {
+    (void)ctx;
+    uint32_t event = cpi_pending_event;
+    cpi_pending_event = 0;
+    if (cpi_cb) {
+        cpi_cb(event);
+    }
+}
+
+static void synthetic_frame(uint8_t *dst, uint32_t size) {
+    // Diagonal ramp moving one step per frame
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = (uint8_t)((i % 256) + (i / 4096) + frame_count);
+    }
+}
+
+static bool read_frame(uint8_t *dst, uint32_t size) {
+    if (input_file == NULL) {
+        synthetic_frame(dst, size);
+        return true;
+    }
+
+    if (fread(dst, 1, size, input_file) == size) {
+        return true;
+    }
+
+    if (loop_input) {
+        rewind(input_file);
+        return fread(dst, 1, size, input_file) == size;
+    }
+    return false;
+}
+
+static ARM_DRIVER_VERSION cpi_get_version(void) {
+    ARM_DRIVER_VERSION version = {ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0), ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0)};
+    return version;
+}
+
+static ARM_CPI_CAPABILITIES cpi_get_capabilities(void) {
+    ARM_CPI_CAPABILITIES caps = {.snapshot = 1};
+    return caps;
+}
+
+static int32_t cpi_initialize(ARM_CPI_SignalEvent_t cb_event) {
+    cpi_cb = cb_event;
+
+    const char *input = getenv("VF_HOST_INPUT");
+    const char *frames = getenv("VF_HOST_FRAMES");
+    const char *loop = getenv("VF_HOST_LOOP");
+
+    loop_input = loop && atoi(loop) != 0;
+    frame_limit = frames ? (uint32_t)strtoul(frames, NULL, 0) : 0;
+
+    if (input && input[0]) {
+        input_file = fopen(input, "rb");
+        if (input_file == NULL) {
+            fprintf(stderr, "mock_cpi: cannot open %s\n", input);
+            return ARM_DRIVER_ERROR;
+        }
+    } else if (frame_limit == 0) {
+        frame_limit = MOCK_DEFAULT_SYNTHETIC_FRAMES;
+    }
+    return ARM_DRIVER_OK;
+}
+
+static int32_t cpi_uninitialize(void) {
+    if (input_file) {
+        fclose(input_file);
+        input_file = NULL;
+    }
+    cpi_cb = NULL;
+    return ARM_DRIVER_OK;
+}
+
+static int32_t cpi_power_control(ARM_POWER_STATE state) {
+    cpi_powered = state == ARM_POWER_FULL;
+    return ARM_DRIVER_OK;
+}
+
+static int32_t cpi_capture_frame(void *framebuffer_startaddr) {
+    if (!cpi_powered) {
+        return ARM_DRIVER_ERROR;
+    }
+
+    if (frame_limit && frame_count >= frame_limit) {
+        // End of the recorded stream is a normal end of the run
+        host_set_exit_status(0);
+        return ARM_DRIVER_ERROR;
+    }
+
+#if RTE_ISP
+    (void)framebuffer_startaddr;
+    if (isp_queued == 0) {
+        return ARM_DRIVER_ERROR;
+    }
+    uint8_t *dst = (uint8_t *)isp_queue[0]->planes[0].dmaPhyAddr;
+#else
+    uint8_t *dst = framebuffer_startaddr;
+#endif
+
+    if (!read_frame(dst, MOCK_FRAME_SIZE)) {
+        host_set_exit_status(0);
+        return ARM_DRIVER_ERROR;
+    }
+    frame_count++;
+
+    cpi_pending_event |= MOCK_FRAME_EVENT;
+    host_irq_post(cpi_irq, NULL);
+    return ARM_DRIVER_OK;
+}
+
+static int32_t cpi_capture_video(void *framebuffer_startaddr) {
+    (void)framebuffer_startaddr;
+    return ARM_DRIVER_ERROR_UNSUPPORTED;
+}
+
+static int32_t cpi_stop(void) {
+    return ARM_DRIVER_OK;
+}
+
+static int32_t cpi_control(uint32_t control, uintptr_t arg) {
+    switch (control) {
+        case CPI_CONFIGURE:
+        case CPI_CAMERA_SENSOR_CONFIGURE:
+        case CPI_CAMERA_SENSOR_GAIN:
+            return ARM_DRIVER_OK;
+        case CPI_EVENTS_CONFIGURE:
+            cpi_event_mask = (uint32_t)arg;
+            return ARM_DRIVER_OK;
+#if RTE_ISP
+        case ISP_CONTROL_QBUF:
+            if (isp_queued >= RTE_ISP_BUFFER_COUNT) {
+                return ARM_DRIVER_ERROR;
+            }
+            isp_queue[isp_queued++] = (VIDEO_BUF_S *)arg;
+            return ARM_DRIVER_OK;
+        case ISP_PROCESS_FRAME_END:
+            return ARM_DRIVER_OK;
+#endif
+        default:
+            return ARM_DRIVER_ERROR_UNSUPPORTED;
+    }
+}
+
+ARM_DRIVER_CPI Driver_CPI = {
+    cpi_get_version, cpi_get_capabilities, cpi_initialize, cpi_uninitialize, cpi_power_control,
+    cpi_capture_frame, cpi_capture_video, cpi_stop, cpi_control,
+};
@@ -0,0 +1,448 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/*
+ * Host build D/AVE2D mock.
+ *
+ * A small software rasterizer that executes the D/AVE2D commands used by
+ * graphics/image.c immediately: framebuffer clear and texture mapped quads
+ * with nearest sampling, CLUT lookup and source-over alpha blending.
+ * It also provides the AIPL D/AVE2D integration layer and the d0lib video
+ * memory allocator.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "aipl_dave2d.h"
+#include "dave_d0lib.h"
+
+#define MOCK_D2_MODE_MASK (~d2_mode_clut)
+
+/* Context state, the device state below applies to every context */
+typedef struct {
+    const uint8_t *tex;
+    d2_s32 tex_pitch;
+    d2_s32 tex_width;
+    d2_s32 tex_height;
+    d2_u32 tex_mode;
+    d2_u8 tex_alpha_op;
+
+    const d2_color *clut;
+    d2_u32 clut_mode;
+
+    d2_point map_x;
+    d2_point map_y;
+    d2_s32 u0;
+    d2_s32 v0;
+    d2_s32 dxu;
+    d2_s32 dxv;
+    d2_s32 dyu;
+    d2_s32 dyv;
+
+    d2_u8 fill_mode;
+} mock_d2_context_t;
+
+typedef struct {
+    uint8_t *fb;
+    d2_s32 fb_pitch;
+    d2_u32 fb_width;
+    d2_u32 fb_height;
+    d2_u32 fb_mode;
+
+    d2_border clip_xmin;
+    d2_border clip_ymin;
+    d2_border clip_xmax;
+    d2_border clip_ymax;
+
+    mock_d2_context_t solid;  // Default context
+    mock_d2_context_t *ctx;   // Selected context
+} mock_d2_state_t;
+
+static mock_d2_state_t d2_state;
+static bool d2_inited;
+
+/* Pixel access, colors are handled as ARGB8888 internally */
+static uint32_t read_argb(const uint8_t *p, d2_u32 mode) {
+    switch (mode & MOCK_D2_MODE_MASK) {
+        case d2_mode_alpha8:
+            return (uint32_t)p[0] << 24 | 0x00FFFFFFU;
+        case d2_mode_rgb565: {
+            uint32_t c = p[0] | (p[1] << 8);
+            uint32_t r = ((c >> 11) & 0x1F) * 255 / 31;
+            uint32_t g = ((c >> 5) & 0x3F) * 255 / 63;
+            uint32_t b = (c & 0x1F) * 255 / 31;
+            return 0xFF000000U | (r << 16) | (g << 8) | b;
+        }
+        case d2_mode_argb4444: {
+            uint32_t c = p[0] | (p[1] << 8);
+            return ((c >> 12) & 0xF) * 0x11000000U | ((c >> 8) & 0xF) * 0x110000U | ((c >> 4) & 0xF) * 0x1100U |
+                   (c & 0xF) * 0x11U;
+        }
+        case d2_mode_rgb888:
+            return 0xFF000000U | ((uint32_t)p[2] << 16) | ((uint32_t)p[1] << 8) | p[0];
+        case d2_mode_argb8888:
+            return p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+        case d2_mode_i8:
+            if (d2_state.ctx->clut == NULL) {
+                return 0;
+            }
+            if (d2_state.ctx->clut_mode == d2_mode_rgb565) {
+                return read_argb((const uint8_t *)&((const uint16_t *)d2_state.ctx->clut)[p[0]], d2_mode_rgb565);
+            }
+            return d2_state.ctx->clut[p[0]];
+        default:
+            return 0;
+    }
+}
+
+static void write_argb(uint8_t *p, d2_u32 mode, uint32_t c) {
+    switch (mode & MOCK_D2_MODE_MASK) {
+        case d2_mode_rgb565: {
+            uint16_t v = (uint16_t)((((c >> 16) & 0xFF) >> 3) << 11 | (((c >> 8) & 0xFF) >> 2) << 5 | ((c & 0xFF) >> 3));
+            p[0] = (uint8_t)v;
+            p[1] = (uint8_t)(v >> 8);
+            break;
+        }
+        case d2_mode_rgb888:
+            p[0] = (uint8_t)c;
+            p[1] = (uint8_t)(c >> 8);
+            p[2] = (uint8_t)(c >> 16);
+            break;
+        case d2_mode_argb8888:
+            p[0] = (uint8_t)c;
+            p[1] = (uint8_t)(c >> 8);
+            p[2] = (uint8_t)(c >> 16);
+            p[3] = (uint8_t)(c >> 24);
+            break;
+        default:
+            break;
+    }
+}
+
+static uint32_t blend_over(uint32_t src, uint32_t dst) {
+    uint32_t a = src >> 24;
+    if (a == 0xFF) {
+        return src;
+    }
+    uint32_t out = 0xFF000000U;
+    for (int shift = 0; shift < 24; shift += 8) {
+        uint32_t s = (src >> shift) & 0xFF;
+        uint32_t d = (dst >> shift) & 0xFF;
+        out |= ((s * a + d * (255 - a) + 127) / 255) << shift;
+    }
+    return out;
+}
+
+/* D/AVE2D driver */
+d2_s32 d2_framebuffer(d2_device *handle, void *ptr, d2_s32 pitch, d2_u32 width, d2_u32 height, d2_s32 format) {
+    (void)handle;
+    d2_state.fb = ptr;
+    d2_state.fb_pitch = pitch;
+    d2_state.fb_width = width;
+    d2_state.fb_height = height;
+    d2_state.fb_mode = (d2_u32)format;
+    d2_state.clip_xmin = 0;
+    d2_state.clip_ymin = 0;
+    d2_state.clip_xmax = (d2_border)width - 1;
+    d2_state.clip_ymax = (d2_border)height - 1;
+    return D2_OK;
+}
+
+d2_s32 d2_clear(d2_device *handle, d2_color color) {
+    (void)handle;
+    uint32_t px_size = aipl_dave2d_mode_px_size(d2_state.fb_mode);
+    for (d2_border y = d2_state.clip_ymin; y <= d2_state.clip_ymax; y++) {
+        uint8_t *row = d2_state.fb + (uint32_t)y * d2_state.fb_pitch * px_size;
+        for (d2_border x = d2_state.clip_xmin; x <= d2_state.clip_xmax; x++) {
+            write_argb(row + (uint32_t)x * px_size, d2_state.fb_mode, 0xFF000000U | color);
+        }
+    }
+    return D2_OK;
+}
+
+d2_s32 d2_startframe(d2_device *handle) {
+    (void)handle;
+    return D2_OK;
+}
+
+d2_s32 d2_endframe(d2_device *handle) {
+    (void)handle;
+    return D2_OK;
+}
+
+// Rendering is synchronous in the mock, the last frame has always finished
+d2_s32 d2_flushframe(d2_device *handle) {
+    (void)handle;
+    return D2_OK;
+}
+
+d2_s32 d2_cliprect(d2_device *handle, d2_border xmin, d2_border ymin, d2_border xmax, d2_border ymax) {
+    (void)handle;
+    d2_state.clip_xmin = xmin < 0 ? 0 : xmin;
+    d2_state.clip_ymin = ymin < 0 ? 0 : ymin;
+    d2_state.clip_xmax = xmax >= (d2_border)d2_state.fb_width ? (d2_border)d2_state.fb_width - 1 : xmax;
+    d2_state.clip_ymax = ymax >= (d2_border)d2_state.fb_height ? (d2_border)d2_state.fb_height - 1 : ymax;
+    return D2_OK;
+}
+
+d2_s32 d2_settextureoperation(d2_device *handle, d2_u8 amode, d2_u8 rmode, d2_u8 gmode, d2_u8 bmode) {
+    (void)handle;
+    (void)rmode;
+    (void)gmode;
+    (void)bmode;
+    d2_state.ctx->tex_alpha_op = amode;
+    return D2_OK;
+}
+
+d2_s32 d2_settexture(d2_device *handle, void *ptr, d2_s32 pitch, d2_s32 width, d2_s32 height, d2_u32 format) {
+    (void)handle;
+    d2_state.ctx->tex = ptr;
+    d2_state.ctx->tex_pitch = pitch;
+    d2_state.ctx->tex_width = width;
+    d2_state.ctx->tex_height = height;
+    d2_state.ctx->tex_mode = format;
+    return D2_OK;
+}
+
+d2_s32 d2_settexturemode(d2_device *handle, d2_u32 mode) {
+    (void)handle;
+    (void)mode;
+    return D2_OK;
+}
+
+d2_s32 d2_setfillmode(d2_device *handle, d2_u8 mode) {
+    (void)handle;
+    d2_state.ctx->fill_mode = mode;
+    return D2_OK;
+}
+
+d2_s32 d2_setblendmode(d2_device *handle, d2_u32 srcfactor, d2_u32 dstfactor) {
+    (void)handle;
+    (void)srcfactor;
+    (void)dstfactor;
+    return D2_OK;
+}
+
+d2_s32 d2_setalphablendmode(d2_device *handle, d2_u32 srcfactor, d2_u32 dstfactor) {
+    (void)handle;
+    (void)srcfactor;
+    (void)dstfactor;
+    return D2_OK;
+}
+
+d2_s32 d2_settexturemapping(d2_device *handle, d2_point x, d2_point y, d2_s32 u0, d2_s32 v0, d2_s32 dxu, d2_s32 dxv,
+                            d2_s32 dyu, d2_s32 dyv) {
+    (void)handle;
+    d2_state.ctx->map_x = x;
+    d2_state.ctx->map_y = y;
+    d2_state.ctx->u0 = u0;
+    d2_state.ctx->v0 = v0;
+    d2_state.ctx->dxu = dxu;
+    d2_state.ctx->dxv = dxv;
+    d2_state.ctx->dyu = dyu;
+    d2_state.ctx->dyv = dyv;
+    return D2_OK;
+}
+
+static d2_point min4(d2_point a, d2_point b, d2_point c, d2_point d) {
+    d2_point m = a < b ? a : b;
+    m = m < c ? m : c;
+    return m < d ? m : d;
+}
+
+static d2_point max4(d2_point a, d2_point b, d2_point c, d2_point d) {
+    d2_point m = a > b ? a : b;
+    m = m > c ? m : c;
+    return m > d ? m : d;
+}
+
+d2_s32 d2_renderquad(d2_device *handle, d2_point x1, d2_point y1, d2_point x2, d2_point y2, d2_point x3, d2_point y3,
+                     d2_point x4, d2_point y4, d2_u32 flags) {
+    (void)handle;
+    (void)flags;
+    if (d2_state.fb == NULL || d2_state.ctx->fill_mode != d2_fm_texture || d2_state.ctx->tex == NULL) {
+        return D2_OK;
+    }
+
+    // Only axis aligned quads are used, rasterize the bounding box
+    d2_border xmin = min4(x1, x2, x3, x4) >> 4;
+    d2_border ymin = min4(y1, y2, y3, y4) >> 4;
+    d2_border xmax = max4(x1, x2, x3, x4) >> 4;
+    d2_border ymax = max4(y1, y2, y3, y4) >> 4;
+    xmin = xmin < d2_state.clip_xmin ? d2_state.clip_xmin : xmin;
+    ymin = ymin < d2_state.clip_ymin ? d2_state.clip_ymin : ymin;
+    xmax = xmax > d2_state.clip_xmax ? d2_state.clip_xmax : xmax;
+    ymax = ymax > d2_state.clip_ymax ? d2_state.clip_ymax : ymax;
+
+    uint32_t fb_px = aipl_dave2d_mode_px_size(d2_state.fb_mode);
+    uint32_t tex_px = aipl_dave2d_mode_px_size(d2_state.ctx->tex_mode);
+    d2_border mx = d2_state.ctx->map_x >> 4;
+    d2_border my = d2_state.ctx->map_y >> 4;
+
+    for (d2_border y = ymin; y <= ymax; y++) {
+        uint8_t *row = d2_state.fb + (uint32_t)y * d2_state.fb_pitch * fb_px;
+        for (d2_border x = xmin; x <= xmax; x++) {
+            int64_t u = d2_state.ctx->u0 + (int64_t)d2_state.ctx->dxu * (x - mx) + (int64_t)d2_state.ctx->dyu * (y - my);
+            int64_t v = d2_state.ctx->v0 + (int64_t)d2_state.ctx->dxv * (x - mx) + (int64_t)d2_state.ctx->dyv * (y - my);
+            int32_t tu = (int32_t)(u >> 16);
+            int32_t tv = (int32_t)(v >> 16);
+            if (tu < 0 || tv < 0 || tu >= d2_state.ctx->tex_width || tv >= d2_state.ctx->tex_height) {
+                continue;
+            }
+
+            uint32_t src = read_argb(d2_state.ctx->tex + ((uint32_t)tv * d2_state.ctx->tex_pitch + (uint32_t)tu) * tex_px,
+                                     d2_state.ctx->tex_mode);
+            if (d2_state.ctx->tex_alpha_op == d2_to_one) {
+                src |= 0xFF000000U;
+            }
+
+            uint8_t *dst = row + (uint32_t)x * fb_px;
+            write_argb(dst, d2_state.fb_mode, blend_over(src, read_argb(dst, d2_state.fb_mode)));
+        }
+    }
+    return D2_OK;
+}
+
+d2_s32 d2_settexclut(d2_device *handle, d2_color *clut) {
+    (void)handle;
+    d2_state.ctx->clut = clut;
+    return D2_OK;
+}
+
+d2_s32 d2_settexclut_format(d2_device *handle, d2_u32 format) {
+    (void)handle;
+    d2_state.ctx->clut_mode = format;
+    return D2_OK;
+}
+
+d2_context *d2_newcontext(d2_device *handle) {
+    (void)handle;
+    mock_d2_context_t *ctx = calloc(1, sizeof(*ctx));
+    if (ctx != NULL) {
+        ctx->clut_mode = d2_mode_argb8888;
+    }
+    return ctx;
+}
+
+d2_s32 d2_freecontext(d2_device *handle, d2_context *ctx) {
+    (void)handle;
+    if (ctx == d2_state.ctx || ctx == &d2_state.solid) {
+        return D2_ILLEGALMODE;
+    }
+    free(ctx);
+    return D2_OK;
+}
+
+d2_s32 d2_selectcontext(d2_device *handle, d2_context *ctx) {
+    (void)handle;
+    d2_state.ctx = ctx != NULL ? ctx : &d2_state.solid;
+    return D2_OK;
+}
+
+d2_context *d2_getcontext(d2_device *handle, d2_s32 index) {
+    (void)handle;
+    return index == -1 ? d2_state.ctx : &d2_state.solid;
+}
+
+/* AIPL D/AVE2D integration layer */
+d2_s32 aipl_dave2d_init(void) {
+    memset(&d2_state, 0, sizeof(d2_state));
+    d2_state.solid.clut_mode = d2_mode_argb8888;
+    d2_state.ctx = &d2_state.solid;
+    d2_inited = true;
+    return D2_OK;
+}
+
+d2_device *aipl_dave2d_handle(void) {
+    return d2_inited ? &d2_state : NULL;
+}
+
+bool aipl_dave2d_format_supported(aipl_color_format_t format) {
+    switch (format) {
+        case AIPL_COLOR_ALPHA8:
+        case AIPL_COLOR_ARGB8888:
+        case AIPL_COLOR_ARGB4444:
+        case AIPL_COLOR_RGB888:
+        case AIPL_COLOR_RGB565:
+            return true;
+        default:
+            return false;
+    }
+}
+
+uint32_t aipl_dave2d_format_to_mode(aipl_color_format_t format) {
+    switch (format) {
+        case AIPL_COLOR_ALPHA8:
+            return d2_mode_alpha8;
+        case AIPL_COLOR_ARGB8888:
+            return d2_mode_argb8888;
+        case AIPL_COLOR_ARGB4444:
+            return d2_mode_argb4444;
+        case AIPL_COLOR_RGB888:
+            return d2_mode_rgb888;
+        case AIPL_COLOR_RGB565:
+        default:
+            return d2_mode_rgb565;
+    }
+}
+
+uint32_t aipl_dave2d_mode_px_size(uint32_t mode) {
+    switch (mode & MOCK_D2_MODE_MASK) {
+        case d2_mode_alpha8:
+        case d2_mode_i8:
+            return 1;
+        case d2_mode_rgb888:
+            return 3;
+        case d2_mode_argb8888:
+        case d2_mode_rgba8888:
+            return 4;
+        default:
+            return 2;
+    }
+}
+
+bool aipl_dave2d_mode_has_alpha(uint32_t mode) {
+    switch (mode & MOCK_D2_MODE_MASK) {
+        case d2_mode_rgb565:
+        case d2_mode_rgb888:
+            return false;
+        default:
+            return true;
+    }
+}
+
+/* d0lib video memory */
+int d0_initheapmanager(void *heap_start, size_t heap_size, unsigned int mode, void *rheap_start, size_t rheap_size,
+                       unsigned int min_size, unsigned int max_size, unsigned int align_mode) {
+    (void)heap_start;
+    (void)heap_size;
+    (void)mode;
+    (void)rheap_start;
+    (void)rheap_size;
+    (void)min_size;
+    (void)max_size;
+    (void)align_mode;
+    return 1;
+}
+
+void *d0_allocvidmem(size_t size) {
+    void *ptr = NULL;
+    if (posix_memalign(&ptr, 32, size) != 0) {
+        return NULL;
+    }
+    return ptr;
+}
+
+void d0_freevidmem(void *ptr) {
+    free(ptr);
+}
@@ -0,0 +1,84 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/*
+ * Host build of the dual-core pipeline: the application runs as the M55-HP
+ * image, the M55-HE image is emulated by a thread that captures from the CPI
+ * mock into the cross-core frame ring. The MHU doorbells between the two are
+ * a condition variable. In the split build (DUAL_CORE_SPLIT) the thread runs
+ * the conversion worker instead and the HP image keeps the camera.
+ */
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+#include "Driver_Common.h"
+
+#include "camera.h"
+#include "core_link.h"
+#if defined(DUAL_CORE_SPLIT)
+#include "split_convert.h"
+#endif
+
+enum { CORE_HP, CORE_HE, CORE_COUNT };
+
+static pthread_mutex_t doorbell_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t doorbell_cond = PTHREAD_COND_INITIALIZER;
+static bool doorbell_pending[CORE_COUNT];
+
+static __thread int this_core = CORE_HP;
+static bool he_started;
+static pthread_t he_thread;
+
+// M55-HE image: the CPI mock and its simulated interrupts are used by this thread only (not in the split build)
+static void *he_main(void *arg) {
+    (void)arg;
+    this_core = CORE_HE;
+#if defined(DUAL_CORE_SPLIT)
+    split_convert_worker();
+#else
+    if (camera_init() != ARM_DRIVER_OK) {
+        fprintf(stderr, "mock_mhu: camera init of the HE core failed\n");
+        exit(2);
+    }
+    core_link_capture_loop();
+#endif
+    return NULL;
+}
+
+void core_link_doorbell_init(void) {
+    // The HP image connects after its own initialization, boot the HE core then
+    if (this_core == CORE_HP && !he_started) {
+        he_started = true;
+        if (pthread_create(&he_thread, NULL, he_main, NULL) != 0) {
+            fprintf(stderr, "mock_mhu: cannot start the HE core thread\n");
+            exit(2);
+        }
+    }
+}
+
+void core_link_doorbell_ring(void) {
+    pthread_mutex_lock(&doorbell_lock);
+    doorbell_pending[this_core == CORE_HP ? CORE_HE : CORE_HP] = true;
+    pthread_cond_broadcast(&doorbell_cond);
+    pthread_mutex_unlock(&doorbell_lock);
+}
+
+void core_link_doorbell_wait(void) {
+    pthread_mutex_lock(&doorbell_lock);
+    while (!doorbell_pending[this_core]) {
+        pthread_cond_wait(&doorbell_cond, &doorbell_lock);
+    }
+    doorbell_pending[this_core] = false;
+    pthread_mutex_unlock(&doorbell_lock);
+}
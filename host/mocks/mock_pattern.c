@@ -0,0 +1,33 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/*
+ * Host build of the test-pattern viewfinder.
+ *
+ * The pattern source does not use the CPI mock, so VF_HOST_FRAMES is applied
+ * here before main(). Like the CPI mock without an input file, the number of
+ * frames defaults to a short run, and capture fails after the last frame,
+ * which ends the application main loop. Errors before that stop the run with
+ * a __BKPT.
+ */
+#include <stdlib.h>
+
+#include "host_device.h"
+#include "pattern_source.h"
+
+#define MOCK_DEFAULT_PATTERN_FRAMES (10)
+
+__attribute__((constructor)) static void mock_pattern_init(void) {
+    const char *frames = getenv("VF_HOST_FRAMES");
+    uint32_t limit = frames ? (uint32_t)strtoul(frames, NULL, 0) : 0;
+    pattern_source_set_frame_limit(limit ? limit : MOCK_DEFAULT_PATTERN_FRAMES);
+    // The end of the pattern is the normal end of the run, as the end of the input for the CPI mock
+    host_set_exit_status(0);
+}
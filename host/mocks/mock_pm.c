@@ -0,0 +1,229 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/*
+ * Host build low-power mocks: LPTIMER, LPGPIO, deep sleep and the subsystem off state.
+ *
+ * Entering the off state saves the backup SRAM to a file, sleeps for the
+ * programmed LPTIMER period and restarts the executable, like the target
+ * restarts from reset on the LPTIMER wake-up. Environment variables:
+ *  - VF_HOST_WAKEUPS  number of timer wake-ups before the process ends (default 3)
+ *  - VF_HOST_BUTTON=1 the LPGPIO wake-up button reads as pressed
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+#include "Driver_IO.h"
+#include "Driver_LPTIMER.h"
+#include "pm.h"
+
+#define HOST_LPTIMER_CLOCK_HZ (32768)
+#define HOST_DEFAULT_WAKEUPS  (3)
+
+uint8_t host_backup_ram[4096];
+
+static char **host_argv;
+#define HOST_LPTIMER_CHANNELS (4)
+
+static uint32_t lptimer_count[HOST_LPTIMER_CHANNELS];
+static ARM_LPTIMER_SignalEvent_t lptimer_cb[HOST_LPTIMER_CHANNELS];
+static bool lptimer_running[HOST_LPTIMER_CHANNELS];
+
+static void lptimer_sleep(uint32_t count) {
+    uint64_t ns = (uint64_t)count * 1000000000ULL / HOST_LPTIMER_CLOCK_HZ;
+    struct timespec time = { (time_t)(ns / 1000000000ULL), (long)(ns % 1000000000ULL) };
+    nanosleep(&time, NULL);
+}
+
+static const char *backup_ram_path(void) {
+    static char path[64];
+    if (path[0] == 0) {
+        const char *env = getenv("VF_HOST_BACKUP_RAM");
+        if (env) {
+            snprintf(path, sizeof(path), "%s", env);
+        } else {
+            snprintf(path, sizeof(path), "/tmp/vf_host_backup_%d.bin", (int)getpid());
+        }
+    }
+    return path;
+}
+
+/* Restore the backup SRAM when restarted from the emulated off state */
+__attribute__((constructor)) static void host_pm_startup(int argc, char **argv) {
+    (void)argc;
+    host_argv = argv;
+
+    const char *env = getenv("VF_HOST_BACKUP_RAM");
+    if (env) {
+        FILE *f = fopen(env, "rb");
+        if (f) {
+            if (fread(host_backup_ram, 1, sizeof(host_backup_ram), f) != sizeof(host_backup_ram)) {
+                memset(host_backup_ram, 0, sizeof(host_backup_ram));
+            }
+            fclose(f);
+        }
+    }
+}
+
+void pm_core_enter_deep_sleep_request_subsys_off(void) {
+    const char *env = getenv("VF_HOST_WAKEUP");
+    int wakeup = env ? atoi(env) + 1 : 1;
+    env = getenv("VF_HOST_WAKEUPS");
+    int max_wakeups = env ? atoi(env) : HOST_DEFAULT_WAKEUPS;
+
+    fflush(stdout);
+    if (wakeup > max_wakeups) {
+        remove(backup_ram_path());
+        exit(0);
+    }
+
+    const char *path = backup_ram_path();
+    FILE *f = fopen(path, "wb");
+    if (f == NULL || fwrite(host_backup_ram, 1, sizeof(host_backup_ram), f) != sizeof(host_backup_ram)) {
+        fprintf(stderr, "host: cannot save backup SRAM to %s\n", path);
+        exit(3);
+    }
+    fclose(f);
+
+    // Off until the LPTIMER expires
+    lptimer_sleep(lptimer_count[0]);
+
+    char wakeup_str[16];
+    snprintf(wakeup_str, sizeof(wakeup_str), "%d", wakeup);
+    setenv("VF_HOST_WAKEUP", wakeup_str, 1);
+    setenv("VF_HOST_BACKUP_RAM", path, 1);
+    execv("/proc/self/exe", host_argv);
+
+    fprintf(stderr, "host: restart after the off state failed\n");
+    exit(3);
+}
+
+/* LPTIMER */
+static ARM_DRIVER_VERSION lptimer_get_version(void) {
+    ARM_DRIVER_VERSION version = { 0, 0 };
+    return version;
+}
+
+static int32_t lptimer_initialize(uint8_t channel, ARM_LPTIMER_SignalEvent_t cb_event) {
+    if (channel >= HOST_LPTIMER_CHANNELS) {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+    lptimer_cb[channel] = cb_event;
+    return ARM_DRIVER_OK;
+}
+
+static int32_t lptimer_power_control(uint8_t channel, ARM_POWER_STATE state) {
+    (void)channel;
+    (void)state;
+    return ARM_DRIVER_OK;
+}
+
+static int32_t lptimer_control(uint8_t channel, uint32_t control_code, void *arg) {
+    if (channel >= HOST_LPTIMER_CHANNELS) {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+    if (control_code == ARM_LPTIMER_SET_COUNT1) {
+        lptimer_count[channel] = *(uint32_t *)arg;
+    }
+    return ARM_DRIVER_OK;
+}
+
+static int32_t lptimer_start(uint8_t channel) {
+    if (channel >= HOST_LPTIMER_CHANNELS) {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+    lptimer_running[channel] = true;
+    return ARM_DRIVER_OK;
+}
+
+static int32_t lptimer_stop(uint8_t channel) {
+    if (channel >= HOST_LPTIMER_CHANNELS) {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+    lptimer_running[channel] = false;
+    return ARM_DRIVER_OK;
+}
+
+static int32_t lptimer_uninitialize(uint8_t channel) {
+    if (channel >= HOST_LPTIMER_CHANNELS) {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+    lptimer_cb[channel] = NULL;
+    return ARM_DRIVER_OK;
+}
+
+ARM_DRIVER_LPTIMER DRIVER_LPTIMER0 = {
+    lptimer_get_version, lptimer_initialize, lptimer_power_control, lptimer_control,
+    lptimer_start,       lptimer_stop,       lptimer_uninitialize,
+};
+
+/*
+ * Deep sleep until the first running LPTIMER channel with an event callback
+ * underflows. Without one the core wakes up like from __WFI().
+ */
+void pm_core_enter_deep_sleep(void) {
+    for (uint8_t channel = 0; channel < HOST_LPTIMER_CHANNELS; channel++) {
+        if (lptimer_running[channel] && lptimer_cb[channel]) {
+            lptimer_sleep(lptimer_count[channel]);
+            lptimer_cb[channel](ARM_LPTIMER_EVENT_UNDERFLOW);
+            return;
+        }
+    }
+    __WFI();
+}
+
+/* LPGPIO, the wake-up button input */
+static int32_t lpgpio_pin_op(uint8_t pin_no) {
+    (void)pin_no;
+    return ARM_DRIVER_OK;
+}
+
+static int32_t lpgpio_initialize(uint8_t pin_no, ARM_GPIO_SignalEvent_t cb_event) {
+    (void)cb_event;
+    return lpgpio_pin_op(pin_no);
+}
+
+static int32_t lpgpio_power_control(uint8_t pin_no, ARM_POWER_STATE state) {
+    (void)state;
+    return lpgpio_pin_op(pin_no);
+}
+
+static int32_t lpgpio_set(uint8_t pin_no, uint32_t value) {
+    (void)value;
+    return lpgpio_pin_op(pin_no);
+}
+
+static int32_t lpgpio_get_direction(uint8_t pin_no, uint32_t *dir) {
+    *dir = GPIO_PIN_DIRECTION_INPUT;
+    return lpgpio_pin_op(pin_no);
+}
+
+static int32_t lpgpio_get_value(uint8_t pin_no, uint32_t *value) {
+    // Active low button
+    const char *env = getenv("VF_HOST_BUTTON");
+    *value = (env && atoi(env)) ? 0 : 1;
+    return lpgpio_pin_op(pin_no);
+}
+
+static int32_t lpgpio_control(uint8_t pin_no, uint32_t control_code, uint32_t *arg) {
+    (void)control_code;
+    (void)arg;
+    return lpgpio_pin_op(pin_no);
+}
+
+ARM_DRIVER_GPIO Driver_GPIOLP = {
+    lpgpio_initialize, lpgpio_power_control, lpgpio_set,     lpgpio_get_direction,
+    lpgpio_set,        lpgpio_get_value,     lpgpio_control, lpgpio_pin_op,
+};
@@ -0,0 +1,176 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/*
+ * Two-thread test of the cross-core frame ring (core_link.c).
+ *
+ * A second thread runs the HE side, core_link_capture_loop() with a camera
+ * stub that writes the frame number into every slot and fails after
+ * TEST_FRAMES frames. The main thread is the HP side and checks every frame
+ * it receives: the sequence number after the skipped frames, the slot of the
+ * sequence, the slot contents and the CORE_LINK_END descriptor at the end.
+ * The ring wraps many times. The HP side sleeps now and then while holding a
+ * frame, so that the HE side finds the ring full and has to wait for its
+ * doorbell, and between frames, so that it finds more than one frame and
+ * takes the newest. It checks the slot contents again before the release, the
+ * HE side must not capture into a held slot.
+ */
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+#include "Driver_Common.h"
+
+#include "core_link.h"
+
+#define TEST_FRAMES (1000)
+// The HP side sleeps while holding every TEST_SLOW_EVERY-th frame and after releasing every TEST_SKIP_EVERY-th one
+#define TEST_SLOW_EVERY (7)
+#define TEST_SKIP_EVERY (5)
+#define TEST_SLOW_US (2000)
+
+static int failures;
+
+#define CHECK(cond, ...)                                                  \
+    do {                                                                  \
+        if (!(cond)) {                                                    \
+            fprintf(stderr, "core_link_test:%d: ", __LINE__);             \
+            fprintf(stderr, __VA_ARGS__);                                 \
+            fprintf(stderr, "\n");                                        \
+            failures++;                                                   \
+        }                                                                 \
+    } while (0)
+
+/* Doorbell between the two threads */
+
+enum { CORE_HP, CORE_HE, CORE_COUNT };
+
+static pthread_mutex_t doorbell_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t doorbell_cond = PTHREAD_COND_INITIALIZER;
+static bool doorbell_pending[CORE_COUNT];
+static atomic_uint doorbell_waits[CORE_COUNT];
+static __thread int this_core = CORE_HP;
+
+void core_link_doorbell_init(void) {
+}
+
+void core_link_doorbell_ring(void) {
+    pthread_mutex_lock(&doorbell_lock);
+    doorbell_pending[this_core == CORE_HP ? CORE_HE : CORE_HP] = true;
+    pthread_cond_broadcast(&doorbell_cond);
+    pthread_mutex_unlock(&doorbell_lock);
+}
+
+void core_link_doorbell_wait(void) {
+    atomic_fetch_add(&doorbell_waits[this_core], 1);
+    pthread_mutex_lock(&doorbell_lock);
+    while (!doorbell_pending[this_core]) {
+        pthread_cond_wait(&doorbell_cond, &doorbell_lock);
+    }
+    doorbell_pending[this_core] = false;
+    pthread_mutex_unlock(&doorbell_lock);
+}
+
+/* Camera and PMU of the HE side */
+
+static uint8_t *capture_buffer;
+static uint32_t captured;
+
+uint32_t host_pmu_get_ccntr(void) {
+    return 0;
+}
+
+void camera_set_frame_buffer(void *buffer) {
+    capture_buffer = buffer;
+}
+
+int camera_capture(void) {
+    if (captured == TEST_FRAMES) {
+        return ARM_DRIVER_ERROR;
+    }
+    memset(capture_buffer, (uint8_t)captured, CORE_LINK_SLOT_SIZE);
+    memcpy(capture_buffer, &captured, sizeof(captured));
+    captured++;
+    return ARM_DRIVER_OK;
+}
+
+static void *he_main(void *arg) {
+    (void)arg;
+    this_core = CORE_HE;
+    core_link_capture_loop();
+    return NULL;
+}
+
+static bool slot_holds(const uint8_t *data, uint32_t sequence) {
+    uint32_t stored;
+    memcpy(&stored, data, sizeof(stored));
+    return stored == sequence && data[sizeof(stored)] == (uint8_t)sequence &&
+           data[CORE_LINK_SLOT_SIZE - 1] == (uint8_t)sequence;
+}
+
+int main(void) {
+    pthread_t he_thread;
+    if (pthread_create(&he_thread, NULL, he_main, NULL) != 0) {
+        fprintf(stderr, "core_link_test: cannot start the HE thread\n");
+        return 2;
+    }
+
+    // Let the HE side fill the ring before the first receive
+    usleep(TEST_SLOW_US);
+    core_link_connect();
+
+    uint32_t received = 0;
+    uint32_t skipped = 0;
+    uint32_t next = 0;
+    core_link_frame_t frame;
+    while (core_link_receive(&frame)) {
+        CHECK(frame.sequence == next + frame.skipped, "frame after %u skipped of %u has sequence %u", frame.skipped,
+              next, frame.sequence);
+        CHECK(frame.slot == frame.sequence % CORE_LINK_SLOTS, "frame %u in slot %u", frame.sequence, frame.slot);
+        CHECK(slot_holds(frame.data, frame.sequence), "slot %u does not hold frame %u", frame.slot, frame.sequence);
+        CHECK(!(frame.flags & CORE_LINK_END), "frame %u has the end flag", frame.sequence);
+        received++;
+        skipped += frame.skipped;
+        next = frame.sequence + 1;
+
+        if (received % TEST_SLOW_EVERY == 0) {
+            usleep(TEST_SLOW_US);
+        }
+        CHECK(slot_holds(frame.data, frame.sequence), "slot %u was overwritten while holding frame %u", frame.slot,
+              frame.sequence);
+        core_link_release();
+
+        if (received % TEST_SKIP_EVERY == 0) {
+            usleep(TEST_SLOW_US);
+        }
+    }
+    pthread_join(he_thread, NULL);
+    skipped += frame.skipped;
+
+    CHECK(received + skipped == TEST_FRAMES, "received %u and skipped %u frames, expected %u", received, skipped,
+          TEST_FRAMES);
+    CHECK(CORE_LINK_SLOTS == 1 || skipped > 0, "the HP side never skipped to the newest frame");
+    CHECK(frame.flags & CORE_LINK_END, "the stream ended without CORE_LINK_END");
+    CHECK(frame.sequence == TEST_FRAMES, "end of the stream has sequence %u", frame.sequence);
+    CHECK(frame.slot == TEST_FRAMES % CORE_LINK_SLOTS, "end of the stream in slot %u", frame.slot);
+    CHECK(atomic_load(&doorbell_waits[CORE_HE]) > 0, "the HE side never found the ring full");
+    CHECK(atomic_load(&doorbell_waits[CORE_HP]) > 0, "the HP side never found the ring empty");
+
+    printf("core_link_test: %u frames through %u slots, %u received, %u skipped, HE waited %u times, HP %u times: "
+           "%s\n", TEST_FRAMES, (unsigned)CORE_LINK_SLOTS, received, skipped, atomic_load(&doorbell_waits[CORE_HE]),
+           atomic_load(&doorbell_waits[CORE_HP]), failures ? "FAILED" : "passed");
+    return failures ? 1 : 0;
+}
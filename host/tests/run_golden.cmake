@@ -0,0 +1,90 @@
+# Golden image regression test for one pipeline configuration.
+#
+#   cmake -DVIEWFINDER=<exe> -DIMGCMP=<exe> -DGOLDEN_DIR=<dir> -DWORK_DIR=<dir>
+#         [-DEXACT=ON] [-DPSNR=<dB>] [-DSSIM=<index>] [-DRECORD=<archive>]
+#         -P run_golden.cmake
+#
+# Runs the host viewfinder on the recorded frames of GOLDEN_DIR/input.tar.xz and
+# compares every displayed frame against the golden images of
+# GOLDEN_DIR/frames.tar.xz. With RECORD the displayed frames are packed into
+# the RECORD archive instead, for review; the source tree is never written.
+foreach(var VIEWFINDER IMGCMP GOLDEN_DIR WORK_DIR)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not set")
+    endif()
+endforeach()
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR}/golden ${WORK_DIR}/out)
+
+function(extract archive)
+    execute_process(COMMAND ${CMAKE_COMMAND} -E tar xf ${archive}
+        WORKING_DIRECTORY ${WORK_DIR}/golden RESULT_VARIABLE rc)
+    if(NOT rc EQUAL 0)
+        message(FATAL_ERROR "Cannot extract ${archive}")
+    endif()
+endfunction()
+
+extract(${GOLDEN_DIR}/input.tar.xz)
+if(NOT RECORD)
+    if(NOT EXISTS ${GOLDEN_DIR}/frames.tar.xz)
+        message(FATAL_ERROR "No golden images in ${GOLDEN_DIR}, record them with the record_golden target")
+    endif()
+    extract(${GOLDEN_DIR}/frames.tar.xz)
+endif()
+
+file(GLOB golden_frames RELATIVE ${WORK_DIR}/golden ${WORK_DIR}/golden/frame_*.ppm)
+list(LENGTH golden_frames golden_count)
+
+# Every input frame is shown, the input ends the run
+set(ENV{VF_HOST_INPUT} ${WORK_DIR}/golden/input.raw)
+set(ENV{VF_HOST_OUTPUT} ${WORK_DIR}/out)
+unset(ENV{VF_HOST_FRAMES})
+unset(ENV{VF_HOST_LOOP})
+unset(ENV{VF_HOST_MRAM})
+execute_process(COMMAND ${VIEWFINDER} RESULT_VARIABLE rc OUTPUT_VARIABLE log ERROR_VARIABLE log)
+if(NOT rc EQUAL 0)
+    message(FATAL_ERROR "${VIEWFINDER} failed (${rc}):\n${log}")
+endif()
+
+file(GLOB frames RELATIVE ${WORK_DIR}/out ${WORK_DIR}/out/frame_*.ppm)
+list(LENGTH frames frame_count)
+if(frame_count EQUAL 0)
+    message(FATAL_ERROR "No frames were displayed:\n${log}")
+endif()
+
+if(RECORD)
+    get_filename_component(record_dir ${RECORD} DIRECTORY)
+    file(MAKE_DIRECTORY ${record_dir})
+    execute_process(COMMAND ${CMAKE_COMMAND} -E tar cJf ${RECORD} ${frames}
+        WORKING_DIRECTORY ${WORK_DIR}/out RESULT_VARIABLE rc)
+    if(NOT rc EQUAL 0)
+        message(FATAL_ERROR "Cannot write ${RECORD}")
+    endif()
+    message(STATUS "Recorded ${frame_count} frames in ${RECORD}, review them before replacing "
+                   "${GOLDEN_DIR}/frames.tar.xz")
+    return()
+endif()
+
+if(NOT frame_count EQUAL golden_count)
+    message(FATAL_ERROR "Displayed ${frame_count} frames, expected ${golden_count}")
+endif()
+
+if(EXACT)
+    set(cmp_args --exact)
+else()
+    set(cmp_args --psnr ${PSNR} --ssim ${SSIM})
+endif()
+
+set(failed 0)
+foreach(frame ${frames})
+    execute_process(COMMAND ${IMGCMP} ${WORK_DIR}/out/${frame} ${WORK_DIR}/golden/${frame} ${cmp_args}
+        RESULT_VARIABLE rc)
+    if(NOT rc EQUAL 0)
+        math(EXPR failed "${failed} + 1")
+    endif()
+endforeach()
+
+if(failed GREATER 0)
+    message(FATAL_ERROR "${failed} of ${frame_count} frames differ from the golden images")
+endif()
@@ -0,0 +1,196 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/*
+ * Two-thread test of the split Bayer conversion (split_convert.c).
+ *
+ * The HE worker runs in the second thread of the MHU mock. The AIPL kernels
+ * are replaced by stubs: the demosaic reads SPLIT_CONVERT_OVERLAP / 2 rows
+ * and one column on each side of a pixel and treats the band edges as image
+ * borders like the real one, color and gamma correction change every byte.
+ * Every frame converted on both cores must be byte-identical to the frame
+ * converted in one piece, whatever split row the calibration picks.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#include "aipl_color_correction.h"
+#include "aipl_demosaic.h"
+#include "aipl_lut_transform.h"
+#include "camera.h"
+#include "disp.h"
+#include "split_convert.h"
+
+#define TEST_FRAMES (16)
+
+// Rows read on each side by the demosaic stub, the most the seam band of split_convert.c covers
+#define DEMOSAIC_RADIUS (SPLIT_CONVERT_OVERLAP / 2)
+
+uint32_t SystemCoreClock = 400000000;
+
+// Wall time in core cycles, so that the calibration of the split row sees the time of both threads
+uint32_t host_pmu_get_ccntr(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(((uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec) * (SystemCoreClock / 1000000) / 1000);
+}
+
+/* AIPL stubs */
+
+uint32_t aipl_color_format_depth(aipl_color_format_t format) {
+    switch (format) {
+        case AIPL_COLOR_ARGB8888:
+            return 32;
+        case AIPL_COLOR_RGB888:
+            return 24;
+        default:
+            return 16;
+    }
+}
+
+const char *aipl_error_str(aipl_error_t error) {
+    return error == AIPL_ERR_OK ? "ok" : "error";
+}
+
+static uint32_t clamp_index(int32_t index, uint32_t count) {
+    return index < 0 ? 0 : (uint32_t)index >= count ? count - 1 : (uint32_t)index;
+}
+
+aipl_error_t aipl_demosaic(const void *in, void *out, uint32_t pitch, uint32_t width, uint32_t height,
+                           aipl_bayer_filter_t filter, aipl_color_format_t format) {
+    const uint8_t *raw = in;
+    const uint32_t px_size = aipl_color_format_depth(format) / 8;
+    for (uint32_t y = 0; y < height; y++) {
+        uint8_t *row = (uint8_t *)out + y * pitch * px_size;
+        for (uint32_t x = 0; x < width; x++) {
+            // Every pixel of the neighbourhood with its own weight, so that a wrong row shows
+            uint32_t sum = 0;
+            for (int32_t dy = -DEMOSAIC_RADIUS; dy <= DEMOSAIC_RADIUS; dy++) {
+                for (int32_t dx = -1; dx <= 1; dx++) {
+                    uint32_t sy = clamp_index((int32_t)y + dy, height);
+                    uint32_t sx = clamp_index((int32_t)x + dx, width);
+                    sum += raw[sy * pitch + sx] * (uint32_t)(3 * (dy + DEMOSAIC_RADIUS) + dx + 2);
+                }
+            }
+            sum += ((y & 1) * 2 + (x & 1)) * 61 + filter;
+            for (uint32_t i = 0; i < px_size; i++) {
+                row[x * px_size + i] = (uint8_t)(sum >> (i * 3));
+            }
+        }
+    }
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_color_correction_rgb_img(const aipl_image_t *in, aipl_image_t *out, const float *ccm) {
+    // Per channel, like the matrix
+    const uint32_t px_size = aipl_color_format_depth(in->format) / 8;
+    for (uint32_t i = 0; i < in->height * in->pitch * px_size; i++) {
+        ((uint8_t *)out->data)[i] = (uint8_t)(((const uint8_t *)in->data)[i] * 5 + (int)ccm[i % px_size]);
+    }
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_lut_transform_rgb_img(const aipl_image_t *in, aipl_image_t *out, uint8_t *lut) {
+    const uint32_t row_bytes = in->pitch * aipl_color_format_depth(in->format) / 8;
+    for (uint32_t i = 0; i < in->height * row_bytes; i++) {
+        ((uint8_t *)out->data)[i] = lut[((const uint8_t *)in->data)[i]];
+    }
+    return AIPL_ERR_OK;
+}
+
+/* Camera stubs */
+
+const float *camera_get_color_correction_matrix(void) {
+    static const float ccm[9] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    return ccm;
+}
+
+uint8_t *camera_get_gamma_lut(void) {
+    static uint8_t lut[256];
+    for (int i = 0; i < 256; i++) {
+        lut[i] = (uint8_t)(255 - i);
+    }
+    return lut;
+}
+
+static uint8_t raw_frame[CAM_FRAME_HEIGHT][CAM_FRAME_WIDTH];
+static uint8_t split_frame[CAM_FRAME_HEIGHT][CAM_FRAME_WIDTH * DISP_PIXEL_SIZE];
+static uint8_t single_frame[CAM_FRAME_HEIGHT][CAM_FRAME_WIDTH * DISP_PIXEL_SIZE];
+
+// The conversion of split_convert.c in one piece
+static void convert_single(void) {
+    aipl_demosaic(raw_frame, single_frame, CAM_FRAME_WIDTH, CAM_FRAME_WIDTH, CAM_FRAME_HEIGHT, CAM_BAYER_FORMAT,
+                  DISP_COLOR_FORMAT);
+#if CAM_COLOR_CORRECTION
+    aipl_image_t image = {
+        .data = single_frame,
+        .pitch = CAM_FRAME_WIDTH,
+        .width = CAM_FRAME_WIDTH,
+        .height = CAM_FRAME_HEIGHT,
+        .format = DISP_COLOR_FORMAT
+    };
+    aipl_color_correction_rgb_img(&image, &image, camera_get_color_correction_matrix());
+    aipl_lut_transform_rgb_img(&image, &image, camera_get_gamma_lut());
+#endif
+}
+
+int main(void) {
+    split_convert_connect();
+
+    int failures = 0;
+    srand(1);
+    for (int frame = 0; frame < TEST_FRAMES; frame++) {
+        for (uint32_t i = 0; i < sizeof(raw_frame); i++) {
+            (&raw_frame[0][0])[i] = (uint8_t)rand();
+        }
+        // Stale contents must not survive in either result
+        memset(split_frame, frame, sizeof(split_frame));
+        memset(single_frame, ~frame, sizeof(single_frame));
+
+        aipl_image_t raw = {
+            .data = raw_frame,
+            .pitch = CAM_FRAME_WIDTH,
+            .width = CAM_FRAME_WIDTH,
+            .height = CAM_FRAME_HEIGHT,
+            .format = AIPL_COLOR_I400
+        };
+        aipl_image_t image = {
+            .data = split_frame,
+            .pitch = CAM_FRAME_WIDTH,
+            .width = CAM_FRAME_WIDTH,
+            .height = CAM_FRAME_HEIGHT,
+            .format = DISP_COLOR_FORMAT
+        };
+        if (!split_convert(&raw, &image)) {
+            fprintf(stderr, "split_convert_test: frame %d failed\n", frame);
+            return 1;
+        }
+        split_convert_print_stats();
+        convert_single();
+
+        for (uint32_t y = 0; y < CAM_FRAME_HEIGHT; y++) {
+            if (memcmp(split_frame[y], single_frame[y], sizeof(split_frame[y])) != 0) {
+                fprintf(stderr, "split_convert_test: frame %d differs from the single-core conversion in row %u\n",
+                        frame, (unsigned)y);
+                failures++;
+                break;
+            }
+        }
+    }
+
+    printf("split_convert_test: %d frames of %ux%u: %s\n", TEST_FRAMES, (unsigned)CAM_FRAME_WIDTH,
+           (unsigned)CAM_FRAME_HEIGHT, failures ? "FAILED" : "passed");
+    return failures ? 1 : 0;
+}
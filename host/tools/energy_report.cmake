@@ -0,0 +1,35 @@
+# Run every pipeline configuration on the same synthetic input and print the
+# estimated energy per frame side by side.
+#
+#   cmake -DCONFIGS=<name>=<executable>,... [-DFRAMES=<n>] -P energy_report.cmake
+if(NOT FRAMES)
+    set(FRAMES 30)
+endif()
+
+string(REPLACE "," ";" configs "${CONFIGS}")
+message("Configuration          mJ/frame (estimate)")
+foreach(config ${configs})
+    string(REPLACE "=" ";" config "${config}")
+    list(GET config 0 name)
+    list(GET config 1 executable)
+
+    execute_process(
+        COMMAND ${CMAKE_COMMAND} -E env VF_HOST_FRAMES=${FRAMES} ${executable}
+        OUTPUT_VARIABLE output
+        RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        message(WARNING "${name} exited with ${result}")
+    endif()
+
+    string(REGEX MATCH "Energy summary: [0-9]+ frames, ([0-9.]+) mJ" summary "${output}")
+    if(summary)
+        set(energy ${CMAKE_MATCH_1})
+    else()
+        set(energy "n/a")
+    endif()
+
+    string(LENGTH "${name}" length)
+    math(EXPR padding "23 - ${length}")
+    string(REPEAT " " ${padding} spaces)
+    message("${name}${spaces}${energy}")
+endforeach()
@@ -0,0 +1,155 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/*
+ * Image comparison tool for the golden image regression suite.
+ *
+ *   imgcmp <image.ppm> <golden.ppm> [--exact] [--psnr <dB>] [--ssim <index>]
+ *
+ * Compares two binary PPM (P6) images of the same size. PSNR is computed over
+ * all RGB samples and SSIM over the luma channel using 8x8 windows. Returns 0
+ * when the image is within the given thresholds (or identical with --exact).
+ */
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SSIM_WINDOW (8)
+#define SSIM_STRIDE (4)
+#define SSIM_C1     ((0.01 * 255) * (0.01 * 255))
+#define SSIM_C2     ((0.03 * 255) * (0.03 * 255))
+
+typedef struct {
+    uint32_t width;
+    uint32_t height;
+    uint8_t *rgb;
+} ppm_image_t;
+
+static bool read_ppm(const char *path, ppm_image_t *img) {
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        fprintf(stderr, "imgcmp: cannot open %s\n", path);
+        return false;
+    }
+
+    unsigned int width, height, maxval;
+    if (fscanf(f, "P6 %u %u %u", &width, &height, &maxval) != 3 || maxval != 255 || fgetc(f) == EOF) {
+        fprintf(stderr, "imgcmp: %s is not a binary 8-bit PPM image\n", path);
+        fclose(f);
+        return false;
+    }
+
+    size_t size = (size_t)width * height * 3;
+    img->width = width;
+    img->height = height;
+    img->rgb = malloc(size);
+    bool ok = img->rgb && fread(img->rgb, 1, size, f) == size;
+    if (!ok) {
+        fprintf(stderr, "imgcmp: %s is truncated\n", path);
+    }
+    fclose(f);
+    return ok;
+}
+
+static double psnr(const ppm_image_t *a, const ppm_image_t *b) {
+    size_t size = (size_t)a->width * a->height * 3;
+    double sse = 0.0;
+    for (size_t i = 0; i < size; i++) {
+        double d = (double)a->rgb[i] - b->rgb[i];
+        sse += d * d;
+    }
+    if (sse == 0.0) {
+        return INFINITY;
+    }
+    return 10.0 * log10(255.0 * 255.0 / (sse / size));
+}
+
+static double luma(const ppm_image_t *img, uint32_t x, uint32_t y) {
+    const uint8_t *p = img->rgb + ((size_t)y * img->width + x) * 3;
+    return 0.299 * p[0] + 0.587 * p[1] + 0.114 * p[2];
+}
+
+static double ssim(const ppm_image_t *a, const ppm_image_t *b) {
+    double sum = 0.0;
+    uint32_t windows = 0;
+
+    for (uint32_t wy = 0; wy + SSIM_WINDOW <= a->height; wy += SSIM_STRIDE) {
+        for (uint32_t wx = 0; wx + SSIM_WINDOW <= a->width; wx += SSIM_STRIDE) {
+            double sa = 0, sb = 0, saa = 0, sbb = 0, sab = 0;
+            for (uint32_t y = wy; y < wy + SSIM_WINDOW; y++) {
+                for (uint32_t x = wx; x < wx + SSIM_WINDOW; x++) {
+                    double la = luma(a, x, y);
+                    double lb = luma(b, x, y);
+                    sa += la;
+                    sb += lb;
+                    saa += la * la;
+                    sbb += lb * lb;
+                    sab += la * lb;
+                }
+            }
+            const double n = SSIM_WINDOW * SSIM_WINDOW;
+            double ma = sa / n, mb = sb / n;
+            double va = saa / n - ma * ma;
+            double vb = sbb / n - mb * mb;
+            double cov = sab / n - ma * mb;
+            sum += ((2 * ma * mb + SSIM_C1) * (2 * cov + SSIM_C2)) /
+                   ((ma * ma + mb * mb + SSIM_C1) * (va + vb + SSIM_C2));
+            windows++;
+        }
+    }
+    return windows ? sum / windows : 1.0;
+}
+
+int main(int argc, char **argv) {
+    bool exact = false;
+    double min_psnr = 0.0;
+    double min_ssim = 0.0;
+
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s <image.ppm> <golden.ppm> [--exact] [--psnr <dB>] [--ssim <index>]\n", argv[0]);
+        return 2;
+    }
+    for (int i = 3; i < argc; i++) {
+        if (strcmp(argv[i], "--exact") == 0) {
+            exact = true;
+        } else if (strcmp(argv[i], "--psnr") == 0 && i + 1 < argc) {
+            min_psnr = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--ssim") == 0 && i + 1 < argc) {
+            min_ssim = atof(argv[++i]);
+        } else {
+            fprintf(stderr, "imgcmp: unknown option %s\n", argv[i]);
+            return 2;
+        }
+    }
+
+    ppm_image_t img, golden;
+    if (!read_ppm(argv[1], &img) || !read_ppm(argv[2], &golden)) {
+        return 2;
+    }
+    if (img.width != golden.width || img.height != golden.height) {
+        printf("%s: size %ux%u differs from golden %ux%u\n", argv[1], img.width, img.height, golden.width,
+               golden.height);
+        return 1;
+    }
+
+    size_t size = (size_t)img.width * img.height * 3;
+    bool identical = memcmp(img.rgb, golden.rgb, size) == 0;
+    double p = psnr(&img, &golden);
+    double s = ssim(&img, &golden);
+    printf("%s: PSNR=%.2fdB SSIM=%.5f%s\n", argv[1], p, s, identical ? " (bit-exact)" : "");
+
+    if (exact) {
+        return identical ? 0 : 1;
+    }
+    return (p >= min_psnr && s >= min_ssim) ? 0 : 1;
+}
@@ -31,7 +31,7 @@
 // <o> CPI interrupt priority <0-255>
 // <i> Defines CPI interrupt priority.
 // <i> Default: 0
-#define RTE_CPI_IRQ_PRI                                       0
+#define RTE_CPI_IRQ_PRI                                       32
 
 // <o> CPI CSI halt enable/disable
 //     <0=> disable
@@ -438,7 +438,7 @@
 // <o> CSI2 interrupt priority <0-255>
 // <i> Defines CSI2 interrupt priority.
 // <i> Default: 0
-#define RTE_MIPI_CSI2_IRQ_PRI                                   0
+#define RTE_MIPI_CSI2_IRQ_PRI                                   32
 
 // <e> ARX3A0 [Driver_ARX3A0]
 // <o> Enable/Disable ARX3A0 camera sensor
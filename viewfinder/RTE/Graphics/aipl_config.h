@@ -90,8 +90,13 @@ extern "C" {
 
 /**
  * Enable Helium acceleration
+ *
+ * Can be turned off from the build with AIPL_DISABLE_HELIUM
+ * to compare against the scalar implementations
  */
+#if !defined(AIPL_DISABLE_HELIUM)
 #define AIPL_HELIUM_ACCELERATION
+#endif
 
 /**
  * Include every default function implementation even if it's suboptimal
@@ -126,7 +131,7 @@ extern "C" {
 #define AIPL_CONVERT_I444           TO_ARGB8888
 #define AIPL_CONVERT_NV12           TO_ARGB8888
 #define AIPL_CONVERT_NV21           TO_ARGB8888
-#define AIPL_CONVERT_YUY2           TO_RGB565
+#define AIPL_CONVERT_YUY2           (TO_RGB565 | TO_RGB888 | TO_ARGB8888)
 #define AIPL_CONVERT_UYVY           TO_ARGB8888
 
 #ifdef __cplusplus
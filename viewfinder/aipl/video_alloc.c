@@ -9,10 +9,24 @@
 #include "aipl_video_alloc.h"
 #include "dave_d0lib.h"
 
+#if defined(VIEWFINDER_RTOS)
+#include "FreeRTOS.h"
+#include "task.h"
+#endif
+
 /*********************
  *      DEFINES
  *********************/
 
+/* The d0lib heap is not thread safe, the RTOS pipeline tasks allocate concurrently */
+#if defined(VIEWFINDER_RTOS)
+#define VIDEO_ALLOC_LOCK()      vTaskSuspendAll()
+#define VIDEO_ALLOC_UNLOCK()    (void)xTaskResumeAll()
+#else
+#define VIDEO_ALLOC_LOCK()
+#define VIDEO_ALLOC_UNLOCK()
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -34,12 +48,17 @@
  **********************/
 void* aipl_video_alloc(uint32_t size)
 {
-    return d0_allocvidmem(size);
+    VIDEO_ALLOC_LOCK();
+    void* ptr = d0_allocvidmem(size);
+    VIDEO_ALLOC_UNLOCK();
+    return ptr;
 }
 
 void aipl_video_free(void* ptr)
 {
+    VIDEO_ALLOC_LOCK();
     d0_freevidmem(ptr);
+    VIDEO_ALLOC_UNLOCK();
 }
 /**********************
  *   STATIC FUNCTIONS
@@ -0,0 +1,285 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#include "kernel_bench.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "RTE_Components.h"
+#include <RTE_Device.h>
+#include CMSIS_device_header
+
+#include "aipl_color_conversion.h"
+#include "aipl_color_correction.h"
+#include "aipl_config.h"
+#include "aipl_crop.h"
+#include "aipl_demosaic.h"
+#include "aipl_image.h"
+#include "aipl_lut_transform.h"
+#include "aipl_resize.h"
+#include "aipl_rotate.h"
+#include "aipl_video_alloc.h"
+#include "camera.h"
+#include "disp.h"
+
+// Each kernel is run once to warm up caches and then timed BENCH_ITERATIONS times, the fastest run is reported
+#define BENCH_ITERATIONS (3)
+
+#if defined(AIPL_HELIUM_ACCELERATION) && (__ARM_FEATURE_MVE & 1)
+#define BENCH_VARIANT "helium"
+#else
+#define BENCH_VARIANT "scalar"
+#endif
+
+extern uint32_t SystemCoreClock;
+
+typedef struct {
+    const char *name;
+    uint32_t width;
+    uint32_t height;
+} bench_resolution_t;
+
+#if defined(RTE_Drivers_CAMERA_SENSOR_MT9M114)
+#define BENCH_CAMERA_NAME "MT9M114"
+#elif defined(RTE_Drivers_CAMERA_SENSOR_ARX3A0)
+#define BENCH_CAMERA_NAME "ARX3A0"
+#elif defined(RTE_Drivers_CAMERA_SENSOR_OV5675)
+#define BENCH_CAMERA_NAME "OV5675"
+#endif
+
+// Frame size of the configured camera (camera.h), the other sensors and the ISP output as set in RTE_Device.h
+static const bench_resolution_t resolutions[] = {
+    {BENCH_CAMERA_NAME, CAM_FRAME_WIDTH, CAM_FRAME_HEIGHT},
+#if defined(RTE_ARX3A0_CAMERA_SENSOR_FRAME_WIDTH) && !defined(RTE_Drivers_CAMERA_SENSOR_ARX3A0)
+    {"ARX3A0", RTE_ARX3A0_CAMERA_SENSOR_FRAME_WIDTH, RTE_ARX3A0_CAMERA_SENSOR_FRAME_HEIGHT},
+#endif
+#if defined(RTE_OV5675_CAMERA_SENSOR_FRAME_WIDTH) && !defined(RTE_Drivers_CAMERA_SENSOR_OV5675)
+    {"OV5675", RTE_OV5675_CAMERA_SENSOR_FRAME_WIDTH, RTE_OV5675_CAMERA_SENSOR_FRAME_HEIGHT},
+#endif
+#if defined(RTE_ISP_OUTPUT_WIDTH)
+    {"ISP", RTE_ISP_OUTPUT_WIDTH, RTE_ISP_OUTPUT_HEIGHT},
+#endif
+};
+
+// RGB formats the convert stage can produce from camera frames with the conversions enabled in aipl_config.h
+static const struct {
+    const char *name;
+    aipl_color_format_t format;
+} formats[] = {
+#if (AIPL_CONVERT_YUY2 & TO_RGB565)
+    {"RGB565", AIPL_COLOR_RGB565},
+#endif
+#if (AIPL_CONVERT_YUY2 & TO_RGB888)
+    {"RGB888", AIPL_COLOR_RGB888},
+#endif
+#if (AIPL_CONVERT_YUY2 & TO_ARGB8888)
+    {"ARGB8888", AIPL_COLOR_ARGB8888},
+#endif
+};
+
+typedef enum {
+    KERNEL_DEMOSAIC,
+    KERNEL_COLOR_CORRECTION,
+    KERNEL_LUT_TRANSFORM,
+    KERNEL_CROP,
+    KERNEL_RESIZE,
+    KERNEL_ROTATE,
+    KERNEL_YUY2_TO_RGB565,
+    KERNEL_COUNT
+} bench_kernel_t;
+
+static const char *const kernel_names[KERNEL_COUNT] = {
+    "aipl_demosaic",
+    "aipl_color_correction_rgb_img",
+    "aipl_lut_transform_rgb_img",
+    "aipl_crop_img",
+    "aipl_resize_img",
+    "aipl_rotate_img",
+    "aipl_color_convert_yuy2_to_rgb565",
+};
+
+static const float identity_ccm[9] = {1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+static uint8_t identity_lut[256];
+
+static void fill_pattern(aipl_image_t *image, uint32_t bytes) {
+    uint8_t *data = image->data;
+    for (uint32_t i = 0; i < bytes; i++) {
+        data[i] = (uint8_t)(i * 7 + (i >> 9));
+    }
+}
+
+static aipl_error_t run_kernel(bench_kernel_t kernel, aipl_image_t *in, aipl_image_t *out) {
+    switch (kernel) {
+        case KERNEL_DEMOSAIC:
+            return aipl_demosaic(in->data, out->data, in->pitch, in->width, in->height, AIPL_BAYER_GRBG, out->format);
+        case KERNEL_COLOR_CORRECTION:
+            return aipl_color_correction_rgb_img(in, out, identity_ccm);
+        case KERNEL_LUT_TRANSFORM:
+            return aipl_lut_transform_rgb_img(in, out, identity_lut);
+        case KERNEL_CROP: {
+            // Center square crop as done by the viewfinder main loop
+            uint32_t dim = in->width > in->height ? in->height : in->width;
+            uint32_t left = (in->width - dim) / 2;
+            uint32_t top = (in->height - dim) / 2;
+            return aipl_crop_img(in, out, left, top, left + dim, top + dim);
+        }
+        case KERNEL_RESIZE:
+            return aipl_resize_img(in, out, true);
+        case KERNEL_ROTATE:
+            return aipl_rotate_img(in, out, AIPL_ROTATE_180);
+        case KERNEL_YUY2_TO_RGB565:
+            return aipl_color_convert_yuy2_to_rgb565(in->data, out->data, in->pitch, in->width, in->height);
+        default:
+            return AIPL_ERR_NOT_SUPPORTED;
+    }
+}
+
+// Set up input and output images for a kernel, returns the number of pixels processed per run
+static uint32_t prepare_images(bench_kernel_t kernel, const bench_resolution_t *res, aipl_color_format_t format,
+                               aipl_image_t *in, aipl_image_t *out, aipl_error_t *ret) {
+    uint32_t w = res->width;
+    uint32_t h = res->height;
+    uint32_t dim = w > h ? h : w;
+    uint32_t pixels = w * h;
+
+    aipl_color_format_t in_format = format;
+    uint32_t in_bpp = aipl_color_format_depth(format) / 8;
+    uint32_t out_w = w, out_h = h;
+
+    switch (kernel) {
+        case KERNEL_DEMOSAIC:
+            // Raw 8-bit Bayer input
+            in_format = AIPL_COLOR_ALPHA8;
+            in_bpp = 1;
+            break;
+        case KERNEL_CROP:
+            out_w = out_h = dim;
+            pixels = dim * dim;
+            break;
+        case KERNEL_RESIZE:
+            out_w = out_h = MY_DISP_HOR_RES;
+            pixels = MY_DISP_HOR_RES * MY_DISP_HOR_RES;
+            break;
+        case KERNEL_YUY2_TO_RGB565:
+            in_format = AIPL_COLOR_YUY2;
+            in_bpp = 2;
+            break;
+        default:
+            break;
+    }
+
+    *ret = aipl_image_create(in, w, w, h, in_format);
+    if (*ret != AIPL_ERR_OK) {
+        return 0;
+    }
+    *ret = aipl_image_create(out, out_w, out_w, out_h, kernel == KERNEL_YUY2_TO_RGB565 ? AIPL_COLOR_RGB565 : format);
+    if (*ret != AIPL_ERR_OK) {
+        aipl_image_destroy(in);
+        return 0;
+    }
+    fill_pattern(in, w * h * in_bpp);
+    return pixels;
+}
+
+static void bench_kernel(bench_kernel_t kernel, const bench_resolution_t *res, const char *format_name,
+                         aipl_color_format_t format) {
+    aipl_image_t in, out;
+    aipl_error_t ret;
+    uint32_t pixels = prepare_images(kernel, res, format, &in, &out, &ret);
+    if (pixels == 0) {
+        printf("%-34s %-9s %-13s %10s %10s  %s (%s)\r\n", kernel_names[kernel], format_name, res->name, "-", "-",
+               BENCH_VARIANT, aipl_error_str(ret));
+        return;
+    }
+
+    uint32_t best = UINT32_MAX;
+    ret = run_kernel(kernel, &in, &out);
+    for (int i = 0; i < BENCH_ITERATIONS && ret == AIPL_ERR_OK; i++) {
+        uint32_t cycles = ARM_PMU_Get_CCNTR();
+        ret = run_kernel(kernel, &in, &out);
+        cycles = ARM_PMU_Get_CCNTR() - cycles;
+        if (cycles < best) {
+            best = cycles;
+        }
+    }
+
+    aipl_image_destroy(&out);
+    aipl_image_destroy(&in);
+
+    if (ret != AIPL_ERR_OK) {
+        printf("%-34s %-9s %-13s %10s %10s  %s (%s)\r\n", kernel_names[kernel], format_name, res->name, "-", "-",
+               BENCH_VARIANT, aipl_error_str(ret));
+        return;
+    }
+
+    if (best == 0) {
+        best = 1;
+    }
+    float time_s = (float)best / SystemCoreClock;
+    printf("%-34s %-9s %-13s %10.2f %10.2f  %s\r\n", kernel_names[kernel], format_name, res->name,
+           pixels / time_s / 1000000.0f, (float)best / pixels, BENCH_VARIANT);
+}
+
+/*
+ * Word-by-word clear of video memory, the same loop the startup code runs for
+ * every zero table entry before main(). It gives the boot time that was spent
+ * on video buffers placed in zeroed .bss instead of the .noinit sections.
+ */
+static void bench_startup_clear(void) {
+    const uint32_t size = 1024 * 1024;
+    volatile uint32_t *buffer = aipl_video_alloc(size);
+    if (buffer == NULL) {
+        printf("%-34s %10s\r\n", "startup zero table", "-");
+        return;
+    }
+
+    uint32_t best = UINT32_MAX;
+    for (int i = 0; i <= BENCH_ITERATIONS; i++) {
+        uint32_t cycles = ARM_PMU_Get_CCNTR();
+        for (uint32_t w = 0; w < size / 4; w++) {
+            buffer[w] = 0;
+        }
+        cycles = ARM_PMU_Get_CCNTR() - cycles;
+        if (i > 0 && cycles < best) {
+            best = cycles;
+        }
+    }
+    aipl_video_free((void *)buffer);
+
+    printf("%-34s %10.2f ms/MB\r\n", "startup zero table", best * 1000.0f / SystemCoreClock);
+}
+
+void kernel_bench_run(void) {
+    for (int i = 0; i < 256; i++) {
+        identity_lut[i] = (uint8_t)i;
+    }
+
+    // Enable PMU cycle counter for measurements
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    ARM_PMU_Enable();
+    ARM_PMU_CNTR_Enable(PMU_CNTENSET_CCNTR_ENABLE_Msk);
+
+    printf("\r\nKernel benchmark (%s, core clock %uMHz)\r\n", BENCH_VARIANT, (unsigned)(SystemCoreClock / 1000000));
+    printf("%-34s %-9s %-13s %10s %10s  %s\r\n", "kernel", "format", "resolution", "Mpix/s", "cycles/px", "variant");
+
+    for (uint32_t r = 0; r < sizeof(resolutions) / sizeof(resolutions[0]); r++) {
+        const bench_resolution_t *res = &resolutions[r];
+
+        bench_kernel(KERNEL_YUY2_TO_RGB565, res, "RGB565", AIPL_COLOR_RGB565);
+        for (uint32_t f = 0; f < sizeof(formats) / sizeof(formats[0]); f++) {
+            for (bench_kernel_t k = KERNEL_DEMOSAIC; k < KERNEL_YUY2_TO_RGB565; k++) {
+                bench_kernel(k, res, formats[f].name, formats[f].format);
+            }
+        }
+    }
+
+    bench_startup_clear();
+    printf("Kernel benchmark done\r\n");
+}
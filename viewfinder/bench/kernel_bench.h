@@ -0,0 +1,20 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef KERNEL_BENCH_H_
+#define KERNEL_BENCH_H_
+
+/*
+ * Microbenchmark of the AIPL kernels used by the viewfinder pipeline.
+ * Built into the firmware with the "bench" build types (KERNEL_BENCH) and
+ * into the kernel_bench_host executable of the host build.
+ */
+void kernel_bench_run(void);
+
+#endif  // KERNEL_BENCH_H_
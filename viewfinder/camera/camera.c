@@ -14,6 +14,7 @@
 #include <stdio.h>
 
 #include "Driver_CPI.h"
+#include "frame_queue.h"
 #include "aipl_color_conversion.h"
 #include "aipl_demosaic.h"
 
@@ -30,7 +31,14 @@
 #if defined(RTE_CPI_AXI_PORT) && !RTE_CPI_AXI_PORT
 #error "RTE_CPI_AXI_PORT should be enabled when ISP is disabled"
 #endif
-static uint8_t camera_raw_buffer[CAM_FRAME_SIZE * (CAM_USE_RGB565 ? 2 : 1)] __attribute__((aligned(32), section(".bss.camera_raw_frame_buf")));
+#define CAM_RAW_BUFFER_SIZE (CAM_FRAME_SIZE * (CAM_USE_RGB565 ? 2 : 1))
+#if defined(DUAL_CORE)
+// Frames are captured to the slots of the cross-core frame ring, see camera_set_frame_buffer()
+static uint8_t *camera_raw_buffer;
+#else
+static uint8_t camera_raw_frame_buf[CAM_RAW_BUFFER_SIZE] __attribute__((aligned(32), section(".noinit.camera_raw_frame_buf")));
+static uint8_t *camera_raw_buffer = camera_raw_frame_buf;
+#endif
 #define OUT_IMAGE_PITCH CAM_FRAME_WIDTH
 #define OUT_IMAGE_WIDTH CAM_FRAME_WIDTH
 #define OUT_IMAGE_HEIGHT CAM_FRAME_HEIGHT
@@ -40,14 +48,34 @@ static uint8_t camera_raw_buffer[CAM_FRAME_SIZE * (CAM_USE_RGB565 ? 2 : 1)] __at
 extern ARM_DRIVER_CPI Driver_CPI;
 static ARM_DRIVER_CPI *CAMERAdrv = &Driver_CPI;
 
-typedef enum { CAM_CB_EVENT_NONE = 0, CAM_CB_EVENT_ERROR = (1 << 0), CAM_CB_EVENT_CAPTURE_STOPPED = (1 << 1),
-             ISP_VSYNC_CB_EVENT = (1 << 2), ISP_MI_FRAME_DUMP_EVENT = ( 1 << 3), ISP_FRAME_IN_DETECTED = (1 << 4) } CAM_CB_EVENT;
+// Completed frames and errors reported by the camera interrupt, a slow consumer gets the newest frame
+static frame_queue_t cam_frame_queue;
+static uint32_t cam_frame_sequence;  // Written by the interrupt only
+static frame_event_t cam_frame;      // Last frame captured without error
+
+static void camera_frame_event(uint16_t buffer, uint16_t flags) {
+    frame_event_t event = {.sequence = ++cam_frame_sequence, .buffer = buffer, .flags = flags};
+    frame_queue_push(&cam_frame_queue, &event);
+    camera_event_signal();
+}
+
+__attribute__((weak)) void camera_event_wait(void) {
+    __WFI();
+}
 
-static volatile CAM_CB_EVENT g_cam_cb_events = CAM_CB_EVENT_NONE;
+__attribute__((weak)) void camera_event_signal(void) {
+}
 
 #if RTE_ISP
 static volatile int isp_counter = 0;
 static volatile int isp_mi_counter = 0;
+static bool isp_frame_overflow;  // The frame in flight overran its buffer, written by the interrupt only
+
+// A completed frame skipped for a newer one, finish it so that the ISP gets its buffer back
+static void isp_frame_recycle(const frame_event_t *event) {
+    (void)event;
+    CAMERAdrv->Control(ISP_PROCESS_FRAME_END, 0);
+}
 
 static void isp_buffer_init(void) {
     for (int i = 0; i < RTE_ISP_BUFFER_COUNT; i++) {
@@ -83,25 +111,29 @@ static void isp_buffer_init(void) {
 static void camera_callback(uint32_t event) {
     switch (event) {
         case ARM_CPI_EVENT_CAMERA_CAPTURE_STOPPED:
-            g_cam_cb_events |= CAM_CB_EVENT_CAPTURE_STOPPED;
+            camera_frame_event(0, 0);
             break;
-#if RTE_ISP            
+#if RTE_ISP
         case ARM_ISP_EVENT_FRAME_VSYNC_DETECTED:
             isp_counter++;
-            g_cam_cb_events |= ISP_VSYNC_CB_EVENT;
             break;
         case ARM_ISP_EVENT_FRAME_IN_DETECTED:
-            g_cam_cb_events |= ISP_FRAME_IN_DETECTED;
-            break;            
+            break;
         case ARM_ISP_MI_EVENT_MP_FRAME_END_DETECTED:
+            // An overrun frame was already reported failed
+            if (!isp_frame_overflow) {
+                camera_frame_event(isp_mi_counter % RTE_ISP_BUFFER_COUNT, 0);
+            }
+            isp_frame_overflow = false;
             isp_mi_counter++;
-            g_cam_cb_events |= ISP_MI_FRAME_DUMP_EVENT;
             break;
         case ARM_ISP_MI_EVENT_FILL_MP_Y_DETECTED:
-            g_cam_cb_events |= ISP_MI_FRAME_DUMP_EVENT;
-            break;
         case ARM_ISP_MI_EVENT_MP_Y_WRAP_DETECTED:
-            g_cam_cb_events |= ISP_MI_FRAME_DUMP_EVENT;
+            // Fail the frame in flight at once, its buffer is never handed out
+            if (!isp_frame_overflow) {
+                isp_frame_overflow = true;
+                camera_frame_event(isp_mi_counter % RTE_ISP_BUFFER_COUNT, FRAME_EVENT_ERROR | FRAME_EVENT_OVERFLOW);
+            }
             break;
 #endif
         case ARM_CPI_EVENT_CAMERA_FRAME_HSYNC_DETECTED:
@@ -114,12 +146,18 @@ static void camera_callback(uint32_t event) {
         case ARM_CPI_EVENT_ERR_CAMERA_INPUT_FIFO_OVERRUN:
         case ARM_CPI_EVENT_ERR_CAMERA_OUTPUT_FIFO_OVERRUN:
         default:
-            g_cam_cb_events |= CAM_CB_EVENT_ERROR | CAM_CB_EVENT_CAPTURE_STOPPED;  // Mark error always as stopped
+            camera_frame_event(0, FRAME_EVENT_ERROR);
             break;
     }
 }
 
-int camera_init(void) {
+/* CPI camera frame source */
+static int cpi_source_init(void) {
+#if RTE_ISP
+    frame_queue_init(&cam_frame_queue, isp_frame_recycle);
+#else
+    frame_queue_init(&cam_frame_queue, NULL);
+#endif
 #if RTE_ISP
     isp_buffer_init();
 #endif
@@ -161,7 +199,7 @@ int camera_init(void) {
 #if RTE_ISP
     for (int i = 0; i < RTE_ISP_BUFFER_COUNT; i++) {
         /* Control configuration for camera events */
-        ret = CAMERAdrv->Control(ISP_CONTROL_QBUF, (uint32_t) &buffer_array[i]);
+        ret = CAMERAdrv->Control(ISP_CONTROL_QBUF, (uintptr_t) &buffer_array[i]);
         if(ret != ARM_DRIVER_OK)
         {
             printf("\r\n Error: ISP buffer configuration failed.\r\n");
@@ -178,16 +216,24 @@ int camera_init(void) {
     return ret;
 }
 
-int camera_capture(void) {
-    g_cam_cb_events = CAM_CB_EVENT_NONE;
+static int cpi_source_capture(void *buffer, uint32_t size) {
+    (void)size;
     int ret = ARM_DRIVER_OK;
+    frame_event_t event;
+    bool ready = false;
 #if RTE_ISP
-    CAM_CB_EVENT callback_event = ISP_MI_FRAME_DUMP_EVENT;
-    // It is safe to use dummy buffer address because RTE_CPI_AXI_PORT is disabled
-    ret = CAMERAdrv->CaptureFrame((uint8_t*)0xABCDABCD);
+    // The ISP writes to its own output buffers, a frame it completed since the last capture is used without waiting
+    // for another one
+    (void)buffer;
+    ready = frame_queue_pop_latest(&cam_frame_queue, &event);
+    if (!ready) {
+        // It is safe to use dummy buffer address because RTE_CPI_AXI_PORT is disabled
+        ret = CAMERAdrv->CaptureFrame((uint8_t*)0xABCDABCD);
+    }
 #else
-    CAM_CB_EVENT callback_event = CAM_CB_EVENT_CAPTURE_STOPPED;
-    ret = CAMERAdrv->CaptureFrame(camera_raw_buffer);
+    // Drop events left over from earlier captures, they belong to another buffer
+    frame_queue_flush(&cam_frame_queue);
+    ret = CAMERAdrv->CaptureFrame(buffer);
 #endif
 
     if (ret != ARM_DRIVER_OK) {
@@ -195,10 +241,11 @@ int camera_capture(void) {
         return ret;
     }
 
-    // Wait for capture
-    if (ret == ARM_DRIVER_OK) {
-        while (!(g_cam_cb_events & callback_event)) {
-            __WFI();
+    // Wait for capture, the newest frame if more than one completed
+    while (!ready) {
+        ready = frame_queue_pop_latest(&cam_frame_queue, &event);
+        if (!ready) {
+            camera_event_wait();
         }
     }
 
@@ -210,14 +257,92 @@ int camera_capture(void) {
     }
 #endif
 
-    if (g_cam_cb_events & CAM_CB_EVENT_ERROR) {
-        printf("\r\n Error: g_cam_cb_events = 0x%X\r\n", g_cam_cb_events);
+    if (event.flags & FRAME_EVENT_ERROR) {
+        printf("\r\n Error: camera frame %u failed%s\r\n", (unsigned)event.sequence,
+               (event.flags & FRAME_EVENT_OVERFLOW) ? " (buffer overflow)" : "");
         ret = 0xFFFF;
+    } else {
+        cam_frame = event;
     }
     return ret;
 }
 
-aipl_image_t camera_post_capture_process(bool *buffer_is_dynamic)
+static int cpi_source_uninit(void) {
+    CAMERAdrv->Stop();
+    int ret = CAMERAdrv->PowerControl(ARM_POWER_OFF);
+    if (ret != ARM_DRIVER_OK) {
+        printf("\r\n Error: CAMERA Power Down failed.\r\n");
+        return ret;
+    }
+    return CAMERAdrv->Uninitialize();
+}
+
+const frame_source_t camera_cpi_source = {
+    .name = "CPI camera",
+    .init = cpi_source_init,
+    .capture = cpi_source_capture,
+    .uninit = cpi_source_uninit,
+};
+
+static const frame_source_t *frame_source = &camera_cpi_source;
+
+void camera_set_frame_source(const frame_source_t *source) {
+    frame_source = source;
+}
+
+int camera_init(void) {
+    printf("\r\n Frame source: %s\r\n", frame_source->name);
+    return frame_source->init();
+}
+
+int camera_uninit(void) {
+    return frame_source->uninit ? frame_source->uninit() : ARM_DRIVER_OK;
+}
+
+int camera_capture(void) {
+    return frame_source->capture(camera_frame_buffer(), camera_frame_buffer_size());
+}
+
+void *camera_frame_buffer(void) {
+#if RTE_ISP
+    return y_buffer[cam_frame.buffer];
+#else
+    return camera_raw_buffer;
+#endif
+}
+
+uint32_t camera_frame_buffer_size(void) {
+#if RTE_ISP
+    return ISP_OUTPUT_SIZE_Y;
+#else
+    return CAM_RAW_BUFFER_SIZE;
+#endif
+}
+
+#if !RTE_ISP
+void camera_set_frame_buffer(void *buffer) {
+    camera_raw_buffer = buffer;
+}
+#endif
+
+aipl_image_t camera_frame_image(void) {
+    aipl_image_t frame = {
+        .data = camera_frame_buffer(),
+        .pitch = OUT_IMAGE_PITCH,
+        .width = OUT_IMAGE_WIDTH,
+        .height = OUT_IMAGE_HEIGHT,
+#if RTE_ISP
+        .format = AIPL_COLOR_YUY2
+#elif CAM_USE_RGB565
+        .format = AIPL_COLOR_RGB565
+#else
+        .format = AIPL_COLOR_I400
+#endif
+    };
+    return frame;
+}
+
+aipl_image_t camera_post_capture_process(bool *buffer_is_dynamic, aipl_color_format_t format)
 {
 #if CAM_USE_RGB565
     *buffer_is_dynamic = false;
@@ -231,15 +356,16 @@ aipl_image_t camera_post_capture_process(bool *buffer_is_dynamic)
         .height = CAM_FRAME_HEIGHT,
         .format = AIPL_COLOR_RGB565
     };
+    (void)format;
     return cam_image;
 #else // !CAM_USE_RGB565
-    // Convert camera or ISP output to dynamically allocated RGB565 image
+    // Convert camera or ISP output to dynamically allocated image of the requested format
     aipl_image_t cam_image;
     aipl_error_t aipl_ret = aipl_image_create(&cam_image,
                                               OUT_IMAGE_PITCH,
                                               OUT_IMAGE_WIDTH,
                                               OUT_IMAGE_HEIGHT,
-                                              AIPL_COLOR_RGB565);
+                                              format);
     if (aipl_ret != AIPL_ERR_OK) {
         printf("Error: Failed allocating camera image\r\n");
         cam_image.data = NULL;
@@ -248,23 +374,31 @@ aipl_image_t camera_post_capture_process(bool *buffer_is_dynamic)
     *buffer_is_dynamic = true;
 
 #if RTE_ISP
-    aipl_ret = aipl_color_convert_yuy2_to_rgb565(y_buffer[0], cam_image.data,
-                                                 cam_image.pitch, cam_image.width,
-                                                 cam_image.height);
+    if (format == AIPL_COLOR_RGB565)
+    {
+        aipl_ret = aipl_color_convert_yuy2_to_rgb565(camera_frame_buffer(), cam_image.data,
+                                                     cam_image.pitch, cam_image.width,
+                                                     cam_image.height);
+    }
+    else
+    {
+        aipl_image_t yuy2_image = camera_frame_image();
+        aipl_ret = aipl_color_convert_img(&yuy2_image, &cam_image);
+    }
     if (aipl_ret != AIPL_ERR_OK)
     {
-        printf("\r\nError: Camera format conversion from yuy2 to rgb565 failed (%s)\r\n",
+        printf("\r\nError: Camera format conversion from yuy2 failed (%s)\r\n",
                 aipl_error_str(aipl_ret));
         __BKPT(0);
     }
 #else // !RTE_ISP
     // ARX3A0 camera uses bayer output
     // MT9M114 can use bayer or RGB565 depending on RTE config
-    // Convert raw image to RGB565 buffer using debayering method
+    // Convert raw image to the output format using debayering method
     aipl_ret = aipl_demosaic(camera_raw_buffer, cam_image.data,
                              cam_image.pitch, cam_image.width,
                              cam_image.height, CAM_BAYER_FORMAT,
-                             AIPL_COLOR_RGB565);
+                             format);
     if (aipl_ret != AIPL_ERR_OK)
     {
         printf("\r\nError: Camera output debayering failed (%s)\r\n",
@@ -14,6 +14,7 @@
 #include CMSIS_device_header
 
 #include "aipl_image.h"
+#include "frame_source.h"
 
 // Choose camera parameters based on RTE configuration
 #if defined(RTE_Drivers_CAMERA_SENSOR_MT9M114)
@@ -59,9 +60,29 @@
 #define CAM_MPIX             (CAM_FRAME_SIZE / 1000000.0f)
 #define CAM_FRAME_SIZE_BYTES (CAM_FRAME_SIZE * CAM_BYTES_PER_PIXEL)
 
+// Frame source of the CPI camera (default)
+extern const frame_source_t camera_cpi_source;
+
+// Select the frame source used by camera_init() and camera_capture(), must be called before camera_init()
+void camera_set_frame_source(const frame_source_t *source);
+
 int camera_init(void);
+int camera_uninit(void);
 int camera_capture(void);
-aipl_image_t camera_post_capture_process(bool *buffer_is_dynamic);
+// Convert the captured frame to format (RGB565, RGB888 or ARGB8888), RGB565 camera frames are used as captured
+aipl_image_t camera_post_capture_process(bool *buffer_is_dynamic, aipl_color_format_t format);
+
+// Buffer holding the captured frame in the camera output format (Bayer, RGB565 or ISP YUY2)
+void *camera_frame_buffer(void);
+uint32_t camera_frame_buffer_size(void);
+// Capture to and convert from another buffer of camera_frame_buffer_size() bytes (not with the ISP)
+void camera_set_frame_buffer(void *buffer);
+// Frame buffer as an image: AIPL_COLOR_RGB565, AIPL_COLOR_YUY2 (ISP) or AIPL_COLOR_I400 for raw Bayer (CAM_BAYER_FORMAT)
+aipl_image_t camera_frame_image(void);
+// Wait for the next camera interrupt event, the default sleeps in WFI. Override to block a task instead
+void camera_event_wait(void);
+// Called from the camera interrupt after an event has been queued, the default does nothing
+void camera_event_signal(void);
 const float* camera_get_color_correction_matrix(void);
 uint8_t* camera_get_gamma_lut(void);
 
@@ -0,0 +1,93 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#include "frame_queue.h"
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#if (FRAME_QUEUE_SIZE & (FRAME_QUEUE_SIZE - 1)) != 0
+#error "FRAME_QUEUE_SIZE must be a power of two"
+#endif
+
+#define QUEUE_INDEX(position) ((position) & (FRAME_QUEUE_SIZE - 1))
+
+void frame_queue_init(frame_queue_t *queue, void (*recycle)(const frame_event_t *event)) {
+    queue->head = 0;
+    queue->tail = 0;
+    queue->dropped = 0;
+    queue->flushed = 0;
+    queue->skipped = 0;
+    queue->recycle = recycle;
+}
+
+bool frame_queue_push(frame_queue_t *queue, const frame_event_t *event) {
+    uint32_t head = queue->head;
+    if (head - queue->tail >= FRAME_QUEUE_SIZE) {
+        queue->dropped++;
+        return false;
+    }
+
+    queue->entries[QUEUE_INDEX(head)] = *event;
+    // Publish the entry before the new head
+    __DMB();
+    queue->head = head + 1;
+    return true;
+}
+
+bool frame_queue_pop(frame_queue_t *queue, frame_event_t *event) {
+    uint32_t tail = queue->tail;
+    uint32_t head = queue->head;
+    if (tail == head) {
+        return false;
+    }
+    // Read the entries only after seeing the head that published them
+    __DMB();
+
+    *event = queue->entries[QUEUE_INDEX(tail++)];
+
+    // Release the entry to the producer
+    __DMB();
+    queue->tail = tail;
+    return true;
+}
+
+bool frame_queue_pop_latest(frame_queue_t *queue, frame_event_t *event) {
+    uint32_t tail = queue->tail;
+    uint32_t head = queue->head;
+    if (tail == head) {
+        return false;
+    }
+    // Read the entries only after seeing the head that published them
+    __DMB();
+
+    // Keep the newest entry, stop at errors so that they are always reported
+    *event = queue->entries[QUEUE_INDEX(tail++)];
+    while (tail != head && !(event->flags & FRAME_EVENT_ERROR)) {
+        queue->skipped++;
+        if (queue->recycle) {
+            queue->recycle(event);
+        }
+        *event = queue->entries[QUEUE_INDEX(tail++)];
+    }
+
+    // Release the entries to the producer
+    __DMB();
+    queue->tail = tail;
+    return true;
+}
+
+void frame_queue_flush(frame_queue_t *queue) {
+    uint32_t head = queue->head;
+    queue->flushed += head - queue->tail;
+
+    // Release the entries to the producer
+    __DMB();
+    queue->tail = head;
+}
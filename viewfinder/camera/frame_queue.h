@@ -0,0 +1,75 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef FRAME_QUEUE_H_
+#define FRAME_QUEUE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Lock-free single-producer/single-consumer queue of frame events.
+ *
+ * The producer (typically an interrupt handler) pushes an entry per completed
+ * frame or error, the consumer pops them from thread context. Only the producer
+ * writes head and only the consumer writes tail, so no locking or interrupt
+ * masking is needed.
+ *
+ * frame_queue_pop() returns the entries in order. frame_queue_pop_latest()
+ * is the mailbox pop: it returns the newest entry and hands the older ones to
+ * the recycle callback, so a consumer slower than the producer always gets
+ * the latest frame and the skipped buffers go back to the producer. Error
+ * entries are never skipped.
+ */
+
+// Number of entries, must be a power of two
+#ifndef FRAME_QUEUE_SIZE
+#define FRAME_QUEUE_SIZE (8)
+#endif
+
+// Entry flags
+#define FRAME_EVENT_ERROR    (1U << 0)  // Capture failed, the buffer contents are not valid
+#define FRAME_EVENT_OVERFLOW (1U << 1)  // Buffer filled or wrapped before the end of the frame, with FRAME_EVENT_ERROR
+
+typedef struct {
+    uint32_t sequence;  // Frame sequence number assigned by the producer
+    uint16_t buffer;    // Index of the buffer holding the frame
+    uint16_t flags;     // FRAME_EVENT_* flags
+} frame_event_t;
+
+typedef struct {
+    frame_event_t entries[FRAME_QUEUE_SIZE];
+    volatile uint32_t head;     // Next entry to write, producer only
+    volatile uint32_t tail;     // Next entry to read, consumer only
+    volatile uint32_t dropped;  // Entries lost because the queue was full, producer only
+    uint32_t flushed;           // Entries discarded by frame_queue_flush(), consumer only
+    uint32_t skipped;           // Entries recycled by frame_queue_pop_latest(), consumer only
+    void (*recycle)(const frame_event_t *event);
+} frame_queue_t;
+
+// recycle is called from frame_queue_pop_latest() for the skipped entries and may be NULL
+void frame_queue_init(frame_queue_t *queue, void (*recycle)(const frame_event_t *event));
+
+// Producer side, returns false (and counts the entry as dropped) if the queue is full
+bool frame_queue_push(frame_queue_t *queue, const frame_event_t *event);
+
+// Consumer side, returns false if the queue is empty
+bool frame_queue_pop(frame_queue_t *queue, frame_event_t *event);
+
+// Consumer side, returns the newest entry (or the oldest error) and recycles the entries before it
+bool frame_queue_pop_latest(frame_queue_t *queue, frame_event_t *event);
+
+// Consumer side, discards all pending entries
+void frame_queue_flush(frame_queue_t *queue);
+
+static inline bool frame_queue_empty(const frame_queue_t *queue) {
+    return queue->head == queue->tail;
+}
+
+#endif  // FRAME_QUEUE_H_
@@ -0,0 +1,31 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef FRAME_SOURCE_H_
+#define FRAME_SOURCE_H_
+
+#include <stdint.h>
+
+/*
+ * Source of camera frames behind camera_init() / camera_capture().
+ *
+ * capture() blocks until the next frame is available in the camera frame
+ * buffer, in the camera output format (Bayer, RGB565 or ISP YUY2), and
+ * returns ARM_DRIVER_OK. camera_post_capture_process() then converts it
+ * the same way regardless of where the frame came from.
+ * uninit() is optional and releases the hardware before powering down.
+ */
+typedef struct {
+    const char *name;
+    int (*init)(void);
+    int (*capture)(void *buffer, uint32_t size);
+    int (*uninit)(void);
+} frame_source_t;
+
+#endif  // FRAME_SOURCE_H_
@@ -96,22 +96,22 @@ enum {
 
 #if (ISP_OUTPUT_SIZE_Y)
 uint8_t y_buffer[RTE_ISP_BUFFER_COUNT][ISP_OUTPUT_SIZE_Y] \
-    __attribute__((section(".bss.lcd_frame_buf"), aligned(32)));
+    __attribute__((section(".noinit.isp_frame_buf"), aligned(32)));
 #endif
 
 #if (ISP_OUTPUT_SIZE_CB)
 uint8_t cb_buffer[RTE_ISP_BUFFER_COUNT][ISP_OUTPUT_SIZE_CB] \
-    __attribute__((section(".bss.lcd_frame_buf"), aligned(32)));
+    __attribute__((section(".noinit.isp_frame_buf"), aligned(32)));
 #endif
 
 #if (ISP_OUTPUT_SIZE_CR)
 uint8_t cr_buffer[RTE_ISP_BUFFER_COUNT][ISP_OUTPUT_SIZE_CR] \
-    __attribute__((section(".bss.lcd_frame_buf"), aligned(32)));
+    __attribute__((section(".noinit.isp_frame_buf"), aligned(32)));
 #endif
 
 #if (ISP_OUTPUT_SIZE_CBCR)
 uint8_t cbcr_buffer[RTE_ISP_BUFFER_COUNT][ISP_OUTPUT_SIZE_CBCR] \
-    __attribute__((section(".bss.lcd_frame_buf"), aligned(32)));
+    __attribute__((section(".noinit.isp_frame_buf"), aligned(32)));
 #endif
 
 VIDEO_BUF_S buffer_array[RTE_ISP_BUFFER_COUNT];
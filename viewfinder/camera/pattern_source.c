@@ -0,0 +1,293 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#include "pattern_source.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "Driver_Common.h"
+#include "aipl_color_formats.h"
+#include "aipl_config.h"
+#include "aipl_video_alloc.h"
+#include "camera.h"
+
+#if defined(AIPL_HELIUM_ACCELERATION)
+#include <arm_mve.h>
+#endif
+
+#ifndef PATTERN_SOURCE_PATTERN
+#define PATTERN_SOURCE_PATTERN PATTERN_COLOR_BARS
+#endif
+
+// Number of frames to generate before capture fails, 0 = unlimited
+#ifndef PATTERN_SOURCE_FRAME_LIMIT
+#define PATTERN_SOURCE_FRAME_LIMIT (0)
+#endif
+
+#define CHECKER_SQUARE_SIZE (32)
+#define CHECKER_STEP        (2)     // Pixels per frame
+
+static const char *const pattern_names[PATTERN_COUNT] = { "color bars", "gradient", "moving checkerboard" };
+
+// 75% color bars: white, yellow, cyan, green, magenta, red, blue, black
+static const uint8_t color_bars[8][3] = {
+    { 191, 191, 191 }, { 191, 191, 0 }, { 0, 191, 191 }, { 0, 191, 0 },
+    { 191, 0, 191 }, { 191, 0, 0 }, { 0, 0, 191 }, { 0, 0, 0 },
+};
+
+static pattern_t pattern = PATTERN_SOURCE_PATTERN;
+static uint32_t frame_number;
+static uint32_t frame_limit = PATTERN_SOURCE_FRAME_LIMIT;
+
+// One row of the pattern, one 16-bit lane per channel and pixel
+static uint16_t *line_r;
+static uint16_t *line_g;
+static uint16_t *line_b;
+
+#if !CAM_USE_RGB565 && !RTE_ISP
+// Color channel (0 = R, 1 = G, 2 = B) at [row & 1][column & 1] of the Bayer mosaic
+static const uint8_t bayer_channels[4][2][2] = {
+    [AIPL_BAYER_RGGB] = { { 0, 1 }, { 1, 2 } },
+    [AIPL_BAYER_GBRG] = { { 1, 2 }, { 0, 1 } },
+    [AIPL_BAYER_GRBG] = { { 1, 0 }, { 2, 1 } },
+    [AIPL_BAYER_BGGR] = { { 2, 1 }, { 1, 0 } },
+};
+#endif
+
+void pattern_source_set_pattern(pattern_t new_pattern) {
+    pattern = new_pattern < PATTERN_COUNT ? new_pattern : PATTERN_COLOR_BARS;
+}
+
+void pattern_source_set_frame_limit(uint32_t limit) {
+    frame_limit = limit;
+}
+
+/*
+ * Rows with the same key have identical content, so only the first of them
+ * is generated and the rest are copied.
+ */
+static uint32_t row_key(uint32_t y, uint32_t height) {
+    switch (pattern) {
+    case PATTERN_GRADIENT:
+        return y * 255 / (height - 1);
+    case PATTERN_CHECKERBOARD:
+        return ((y + frame_number * CHECKER_STEP) / CHECKER_SQUARE_SIZE) & 1;
+    default:
+        return 0;
+    }
+}
+
+static void generate_row(uint32_t y, uint32_t width, uint32_t height) {
+    switch (pattern) {
+    case PATTERN_GRADIENT: {
+        uint16_t g = y * 255 / (height - 1);
+        for (uint32_t x = 0; x < width; x++) {
+            line_r[x] = x * 255 / (width - 1);
+            line_g[x] = g;
+            line_b[x] = 255 - line_r[x];
+        }
+        break;
+    }
+    case PATTERN_CHECKERBOARD: {
+        uint32_t offset = frame_number * CHECKER_STEP;
+        uint32_t row_phase = ((y + offset) / CHECKER_SQUARE_SIZE) & 1;
+        for (uint32_t x = 0; x < width; x++) {
+            uint16_t v = ((((x + offset) / CHECKER_SQUARE_SIZE) & 1) ^ row_phase) ? 235 : 16;
+            line_r[x] = v;
+            line_g[x] = v;
+            line_b[x] = v;
+        }
+        break;
+    }
+    default:
+        for (uint32_t x = 0; x < width; x++) {
+            const uint8_t *bar = color_bars[x * 8 / width];
+            line_r[x] = bar[0];
+            line_g[x] = bar[1];
+            line_b[x] = bar[2];
+        }
+        break;
+    }
+}
+
+#if CAM_USE_RGB565
+static void pack_rgb565(uint16_t *dst, uint32_t width) {
+    const uint16_t *r = line_r;
+    const uint16_t *g = line_g;
+    const uint16_t *b = line_b;
+#if defined(AIPL_HELIUM_ACCELERATION)
+    for (int32_t n = width; n > 0; n -= 8) {
+        mve_pred16_t p = vctp16q(n);
+        uint16x8_t vr = vld1q_z_u16(r, p);
+        uint16x8_t vg = vld1q_z_u16(g, p);
+        uint16x8_t vb = vld1q_z_u16(b, p);
+
+        uint16x8_t px = vshlq_n_u16(vshrq_n_u16(vr, 3), 11);
+        px = vorrq_u16(px, vshlq_n_u16(vshrq_n_u16(vg, 2), 5));
+        px = vorrq_u16(px, vshrq_n_u16(vb, 3));
+        vst1q_p_u16(dst, px, p);
+
+        r += 8;
+        g += 8;
+        b += 8;
+        dst += 8;
+    }
+#else
+    for (uint32_t x = 0; x < width; x++) {
+        dst[x] = ((r[x] >> 3) << 11) | ((g[x] >> 2) << 5) | (b[x] >> 3);
+    }
+#endif
+}
+#elif RTE_ISP
+// BT.601 studio range
+#define RGB_TO_Y(r, g, b) ((((66 * (r) + 129 * (g) + 25 * (b) + 128) >> 8) + 16))
+#define RGB_TO_U(r, g, b) ((((-38 * (r) - 74 * (g) + 112 * (b) + 128) >> 8) + 128))
+#define RGB_TO_V(r, g, b) ((((112 * (r) - 94 * (g) - 18 * (b) + 128) >> 8) + 128))
+
+#if defined(AIPL_HELIUM_ACCELERATION)
+static uint16x8_t rgb_to_y(uint16x8_t r, uint16x8_t g, uint16x8_t b) {
+    uint16x8_t acc = vmulq_n_u16(r, 66);
+    acc = vmlaq_n_u16(acc, g, 129);
+    acc = vmlaq_n_u16(acc, b, 25);
+    return vaddq_n_u16(vshrq_n_u16(vaddq_n_u16(acc, 128), 8), 16);
+}
+
+static uint16x8_t rgb_to_chroma(uint16x8_t r, uint16x8_t g, uint16x8_t b, int16_t cr, int16_t cg, int16_t cb) {
+    int16x8_t acc = vmulq_n_s16(vreinterpretq_s16_u16(r), cr);
+    acc = vmlaq_n_s16(acc, vreinterpretq_s16_u16(g), cg);
+    acc = vmlaq_n_s16(acc, vreinterpretq_s16_u16(b), cb);
+    return vreinterpretq_u16_s16(vaddq_n_s16(vshrq_n_s16(vaddq_n_s16(acc, 128), 8), 128));
+}
+#endif
+
+static void pack_yuy2(uint8_t *dst, uint32_t width) {
+    uint32_t x = 0;
+#if defined(AIPL_HELIUM_ACCELERATION)
+    // 8 pixel pairs per iteration, even and odd pixels deinterleaved
+    for (; x + 16 <= width; x += 16) {
+        uint16x8x2_t r = vld2q_u16(&line_r[x]);
+        uint16x8x2_t g = vld2q_u16(&line_g[x]);
+        uint16x8x2_t b = vld2q_u16(&line_b[x]);
+
+        uint16x8_t y0 = rgb_to_y(r.val[0], g.val[0], b.val[0]);
+        uint16x8_t y1 = rgb_to_y(r.val[1], g.val[1], b.val[1]);
+
+        // Chroma of the pixel pair average
+        uint16x8_t ra = vrhaddq_u16(r.val[0], r.val[1]);
+        uint16x8_t ga = vrhaddq_u16(g.val[0], g.val[1]);
+        uint16x8_t ba = vrhaddq_u16(b.val[0], b.val[1]);
+        uint16x8_t u = rgb_to_chroma(ra, ga, ba, -38, -74, 112);
+        uint16x8_t v = rgb_to_chroma(ra, ga, ba, 112, -94, -18);
+
+        // Little endian Y0 U Y1 V
+        uint16x8x2_t out = { { vorrq_u16(y0, vshlq_n_u16(u, 8)), vorrq_u16(y1, vshlq_n_u16(v, 8)) } };
+        vst2q_u16((uint16_t *)&dst[x * 2], out);
+    }
+#endif
+    for (; x + 1 < width; x += 2) {
+        int32_t r = (line_r[x] + line_r[x + 1] + 1) >> 1;
+        int32_t g = (line_g[x] + line_g[x + 1] + 1) >> 1;
+        int32_t b = (line_b[x] + line_b[x + 1] + 1) >> 1;
+        dst[x * 2 + 0] = RGB_TO_Y(line_r[x], line_g[x], line_b[x]);
+        dst[x * 2 + 1] = RGB_TO_U(r, g, b);
+        dst[x * 2 + 2] = RGB_TO_Y(line_r[x + 1], line_g[x + 1], line_b[x + 1]);
+        dst[x * 2 + 3] = RGB_TO_V(r, g, b);
+    }
+}
+#else
+static void pack_bayer(uint8_t *dst, uint32_t width, uint32_t y) {
+    const uint16_t *lines[3] = { line_r, line_g, line_b };
+    const uint16_t *even = lines[bayer_channels[CAM_BAYER_FORMAT][y & 1][0]];
+    const uint16_t *odd = lines[bayer_channels[CAM_BAYER_FORMAT][y & 1][1]];
+#if defined(AIPL_HELIUM_ACCELERATION)
+    // Even lanes from the even column channel, odd lanes from the odd column channel
+    const mve_pred16_t even_lanes = 0x3333;
+    for (int32_t n = width; n > 0; n -= 8) {
+        mve_pred16_t p = vctp16q(n);
+        uint16x8_t px = vpselq_u16(vld1q_z_u16(even, p), vld1q_z_u16(odd, p), even_lanes);
+        vstrbq_p_u16(dst, px, p);
+
+        even += 8;
+        odd += 8;
+        dst += 8;
+    }
+#else
+    for (uint32_t x = 0; x < width; x++) {
+        dst[x] = (x & 1) ? odd[x] : even[x];
+    }
+#endif
+}
+#endif
+
+static int pattern_init(void) {
+    aipl_image_t frame = camera_frame_image();
+
+    // Rounded up to full vectors, the kernels may read past the last pixel
+    uint32_t line_size = ((frame.width + 15) & ~15u) * sizeof(uint16_t);
+    line_r = aipl_video_alloc(line_size);
+    line_g = aipl_video_alloc(line_size);
+    line_b = aipl_video_alloc(line_size);
+    if (line_r == NULL || line_g == NULL || line_b == NULL) {
+        printf("\r\n Error: Test pattern line buffer allocation failed.\r\n");
+        return ARM_DRIVER_ERROR;
+    }
+
+    frame_number = 0;
+    printf("\r\n Test pattern: %s\r\n", pattern_names[pattern]);
+    return ARM_DRIVER_OK;
+}
+
+static int pattern_capture(void *buffer, uint32_t size) {
+    if (frame_limit && frame_number >= frame_limit) {
+        return ARM_DRIVER_ERROR;
+    }
+
+    aipl_image_t frame = camera_frame_image();
+    uint32_t row_size = frame.pitch * aipl_color_format_depth(frame.format) / 8;
+
+    // Last packed row and its key for even and odd rows (Bayer rows alternate channels)
+    uint8_t *last_row[2] = { NULL, NULL };
+    uint32_t last_key[2] = { 0, 0 };
+
+    for (uint32_t y = 0; y < frame.height; y++) {
+        uint8_t *row = (uint8_t *)buffer + y * row_size;
+#if CAM_USE_RGB565 || RTE_ISP
+        uint32_t parity = 0;
+#else
+        uint32_t parity = y & 1;
+#endif
+        uint32_t key = row_key(y, frame.height);
+        if (last_row[parity] && last_key[parity] == key) {
+            memcpy(row, last_row[parity], row_size);
+            continue;
+        }
+
+        generate_row(y, frame.width, frame.height);
+#if CAM_USE_RGB565
+        pack_rgb565((uint16_t *)row, frame.width);
+#elif RTE_ISP
+        pack_yuy2(row, frame.width);
+#else
+        pack_bayer(row, frame.width, y);
+#endif
+        last_row[parity] = row;
+        last_key[parity] = key;
+    }
+
+    SCB_CleanDCache_by_Addr(buffer, size);
+    frame_number++;
+    return ARM_DRIVER_OK;
+}
+
+const frame_source_t pattern_frame_source = {
+    .name = "Test pattern",
+    .init = pattern_init,
+    .capture = pattern_capture,
+};
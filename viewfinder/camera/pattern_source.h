@@ -0,0 +1,37 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef PATTERN_SOURCE_H_
+#define PATTERN_SOURCE_H_
+
+#include "frame_source.h"
+
+typedef enum {
+    PATTERN_COLOR_BARS = 0,     // Eight vertical 75% color bars
+    PATTERN_GRADIENT,           // Red ramp left to right, green ramp top to bottom
+    PATTERN_CHECKERBOARD,       // Checkerboard moving diagonally by a few pixels per frame
+    PATTERN_COUNT
+} pattern_t;
+
+/*
+ * Synthetic test-pattern source.
+ *
+ * Generates the pattern directly in the camera output format (RGB565, YUY2 for
+ * the ISP, or a Bayer mosaic in CAM_BAYER_FORMAT order) with no capture cost,
+ * so that the processing, rendering and display path can be measured on its own.
+ */
+extern const frame_source_t pattern_frame_source;
+
+// Select the pattern, can be changed while capturing
+void pattern_source_set_pattern(pattern_t pattern);
+
+// Stop after limit frames, capture then fails and ends the viewfinder. 0 (default) generates frames forever
+void pattern_source_set_frame_limit(uint32_t limit);
+
+#endif  // PATTERN_SOURCE_H_
@@ -0,0 +1,143 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#include "replay_source.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "Driver_Common.h"
+#include "aipl_video_alloc.h"
+#include "camera.h"
+
+#ifndef REPLAY_SOURCE_FILE
+#define REPLAY_SOURCE_FILE NULL
+#endif
+
+#ifndef REPLAY_SOURCE_INTERVAL_MS
+#define REPLAY_SOURCE_INTERVAL_MS (0)
+#endif
+
+#ifndef REPLAY_SOURCE_FRAME_LIMIT
+#define REPLAY_SOURCE_FRAME_LIMIT (0)
+#endif
+
+// Upper limit for frames loaded from a file into video memory
+#ifndef REPLAY_SOURCE_MAX_FILE_FRAMES
+#define REPLAY_SOURCE_MAX_FILE_FRAMES (8)
+#endif
+
+// Optional recording linked into the image, e.g. generated from a raw dump with xxd -i
+extern const uint8_t replay_frame_data[] __attribute__((weak));
+extern const uint32_t replay_frame_data_count __attribute__((weak));
+
+static const uint8_t *frames;
+static uint32_t frame_count;
+static uint32_t frame_index;
+static uint32_t frames_delivered;
+
+static const char *file_path = REPLAY_SOURCE_FILE;
+static uint32_t interval_clocks = REPLAY_SOURCE_INTERVAL_MS * CLOCKS_PER_SEC / 1000;
+static uint32_t frame_limit = REPLAY_SOURCE_FRAME_LIMIT;
+static clock_t last_capture;
+
+void replay_source_set_frames(const uint8_t *data, uint32_t count) {
+    frames = data;
+    frame_count = count;
+}
+
+void replay_source_set_file(const char *path) {
+    file_path = path;
+}
+
+void replay_source_set_interval_ms(uint32_t interval_ms) {
+    interval_clocks = interval_ms * CLOCKS_PER_SEC / 1000;
+}
+
+void replay_source_set_frame_limit(uint32_t limit) {
+    frame_limit = limit;
+}
+
+static int load_file(const char *path) {
+    const uint32_t frame_size = camera_frame_buffer_size();
+
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        printf("\r\n Error: Replay file %s cannot be opened.\r\n", path);
+        return ARM_DRIVER_ERROR;
+    }
+
+    fseek(f, 0, SEEK_END);
+    long file_size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    uint32_t count = file_size > 0 ? (uint32_t)file_size / frame_size : 0;
+    if (count > REPLAY_SOURCE_MAX_FILE_FRAMES) {
+        count = REPLAY_SOURCE_MAX_FILE_FRAMES;
+    }
+
+    uint8_t *data = count ? aipl_video_alloc(count * frame_size) : NULL;
+    if (data == NULL || fread(data, frame_size, count, f) != count) {
+        printf("\r\n Error: Replay file %s could not be loaded (%u frames).\r\n", path, (unsigned)count);
+        if (data) {
+            aipl_video_free(data);
+        }
+        fclose(f);
+        return ARM_DRIVER_ERROR;
+    }
+    fclose(f);
+
+    replay_source_set_frames(data, count);
+    return ARM_DRIVER_OK;
+}
+
+static int replay_init(void) {
+    if (file_path) {
+        int ret = load_file(file_path);
+        if (ret != ARM_DRIVER_OK) {
+            return ret;
+        }
+    } else if (frames == NULL && replay_frame_data && &replay_frame_data_count) {
+        replay_source_set_frames(replay_frame_data, replay_frame_data_count);
+    }
+
+    if (frames == NULL || frame_count == 0) {
+        printf("\r\n Error: No frames to replay.\r\n");
+        return ARM_DRIVER_ERROR;
+    }
+
+    frame_index = 0;
+    frames_delivered = 0;
+    last_capture = clock();
+    printf("\r\n Replaying %u frames.\r\n", (unsigned)frame_count);
+    return ARM_DRIVER_OK;
+}
+
+static int replay_capture(void *buffer, uint32_t size) {
+    if (frame_limit && frames_delivered >= frame_limit) {
+        return ARM_DRIVER_ERROR;
+    }
+
+    // Pace the frames like a sensor running at a fixed frame rate
+    while ((uint32_t)(clock() - last_capture) < interval_clocks) {
+    }
+    last_capture = clock();
+
+    memcpy(buffer, frames + frame_index * size, size);
+    frame_index = (frame_index + 1) % frame_count;
+    frames_delivered++;
+    return ARM_DRIVER_OK;
+}
+
+const frame_source_t replay_frame_source = {
+    .name = "Replay",
+    .init = replay_init,
+    .capture = replay_capture,
+};
@@ -0,0 +1,42 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef REPLAY_SOURCE_H_
+#define REPLAY_SOURCE_H_
+
+#include <stdint.h>
+
+#include "frame_source.h"
+
+/*
+ * Recorded-frame replay source.
+ *
+ * Cycles through raw frames in the camera output format so that every stage
+ * after capture can be benchmarked on identical input. The frames are taken from
+ *  - a frame table linked into the image (MRAM), see replay_source_set_frames(),
+ *    or the weak replay_frame_data / replay_frame_data_count symbols, or
+ *  - a file (host build, or semihosting on target), see replay_source_set_file().
+ *    The file is loaded into video memory once at init so that file I/O does not
+ *    show up in the frame timing.
+ */
+extern const frame_source_t replay_frame_source;
+
+// Replay frames from memory, frame_count frames of camera_frame_buffer_size() bytes back to back
+void replay_source_set_frames(const uint8_t *frames, uint32_t frame_count);
+
+// Replay frames from a file (loaded at init)
+void replay_source_set_file(const char *path);
+
+// Minimum time between two captured frames, 0 delivers frames as fast as they are requested
+void replay_source_set_interval_ms(uint32_t interval_ms);
+
+// Number of frames to deliver before capture fails (ending the main loop), 0 cycles forever
+void replay_source_set_frame_limit(uint32_t frame_limit);
+
+#endif  // REPLAY_SOURCE_H_
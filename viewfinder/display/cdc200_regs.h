@@ -0,0 +1,97 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef CDC200_REGS_H_
+#define CDC200_REGS_H_
+
+#include <stdint.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+#include <RTE_Device.h>
+
+/*
+ * Registers of the CDC200 display controller that disp.c programs directly,
+ * for what the CDC200 driver of the device pack has no control code: layer 2
+ * and the line interrupt position. The driver keeps the panel timing, layer 1
+ * and the interrupt enables.
+ *
+ * CDC_BASE comes from the device header on the target. On the host it comes
+ * from host_device.h and host/mocks/mock_cdc200.c models the registers.
+ *
+ * Window positions and the line interrupt position count from the start of
+ * the sync pulse, like the timing registers the driver sets up.
+ */
+
+typedef struct {
+    volatile uint32_t CONFIG1;         // 0x00 Layer configuration, read-only
+    volatile uint32_t CONFIG2;         // 0x04
+    volatile uint32_t RELOAD;          // 0x08 Layer shadow reload control
+    volatile uint32_t CONTROL;         // 0x0C
+    volatile uint32_t WINDOW_H;        // 0x10 First [15:0] and last [31:16] column
+    volatile uint32_t WINDOW_V;        // 0x14 First [15:0] and last [31:16] line
+    volatile uint32_t COLOR_KEY;       // 0x18
+    volatile uint32_t PIXEL_FORMAT;    // 0x1C
+    volatile uint32_t CONST_ALPHA;     // 0x20 Constant alpha [7:0]
+    volatile uint32_t DEFAULT_COLOR;   // 0x24
+    volatile uint32_t BLEND;           // 0x28 Blending factors F1 [10:8] and F2 [2:0]
+    volatile uint32_t FB_BUS_CONTROL;  // 0x2C
+    volatile uint32_t AUX_FB_CONTROL;  // 0x30
+    volatile uintptr_t CFB_ADDR;       // 0x34 Color framebuffer, pointer wide so that the host model holds host addresses
+    volatile uint32_t CFB_LENGTH;      // 0x38 Pitch [31:16] and line length [15:0] in bytes
+    volatile uint32_t CFB_LINES;       // 0x3C
+    uint32_t reserved[48];
+} cdc200_layer_regs_t;
+
+typedef struct {
+    volatile uint32_t HW_VERSION;         // 0x00
+    volatile uint32_t LAYER_COUNT;        // 0x04
+    volatile uint32_t SYNC_SIZE;          // 0x08
+    volatile uint32_t BACK_PORCH;         // 0x0C
+    volatile uint32_t ACTIVE_WIDTH;       // 0x10
+    volatile uint32_t TOTAL_WIDTH;        // 0x14
+    volatile uint32_t GLOBAL_CONTROL;     // 0x18
+    volatile uint32_t GLOBAL_CONFIG1;     // 0x1C
+    volatile uint32_t GLOBAL_CONFIG2;     // 0x20
+    volatile uint32_t SHADOW_RELOAD;      // 0x24 Shadow reload control of all layers
+    volatile uint32_t GAMMA_CORRECTION;   // 0x28
+    volatile uint32_t BACKGROUND_COLOR;   // 0x2C
+    uint32_t reserved0;                   // 0x30
+    volatile uint32_t IRQ_ENABLE;         // 0x34
+    volatile uint32_t IRQ_STATUS;         // 0x38
+    volatile uint32_t IRQ_CLEAR;          // 0x3C
+    volatile uint32_t LINE_IRQ_POSITION;  // 0x40 Line of the line interrupt
+    volatile uint32_t POSITION_STATUS;    // 0x44
+    volatile uint32_t BLANKING_STATUS;    // 0x48
+    uint32_t reserved1[45];
+    cdc200_layer_regs_t LAYER[2];         // 0x100 layer 1, 0x200 layer 2
+} cdc200_regs_t;
+
+#define CDC200_REGS ((cdc200_regs_t *)CDC_BASE)
+
+// SHADOW_RELOAD, the written layer registers take effect in the next vertical blanking
+#define CDC200_SHADOW_RELOAD_VBLANK (1U << 1)
+
+// CONTROL
+#define CDC200_LAYER_ENABLE (1U << 0)
+
+// PIXEL_FORMAT, the framebuffer formats 0 to 2 are the RTE_CDC200_PIXEL_FORMAT values
+#define CDC200_LAYER_FORMAT_ARGB4444 (7U)
+
+// BLEND, pixel alpha times constant alpha over the layers below
+#define CDC200_BLEND_PIXEL_ALPHA ((6U << 8) | 7U)
+
+// CFB_LENGTH, the line length register is the bytes per line plus 7 for the 64-bit bus
+#define CDC200_CFB_LENGTH(pitch, bytes) (((uint32_t)(pitch) << 16) | ((uint32_t)(bytes) + 7U))
+
+// First active column and line in the window and line interrupt positions
+#define CDC200_FIRST_ACTIVE_COLUMN (RTE_PANEL_HSYNC_TIME + RTE_PANEL_HBP_TIME)
+#define CDC200_FIRST_ACTIVE_LINE (RTE_PANEL_VSYNC_LINE + RTE_PANEL_VBP_LINE)
+
+#endif  // CDC200_REGS_H_
@@ -14,6 +14,7 @@
 #include CMSIS_device_header
 #include <RTE_Device.h>
 #include "Driver_CDC200.h" // Display driver
+#include "cdc200_regs.h"
 
 /*********************
  *      DEFINES
@@ -53,27 +54,55 @@ typedef uint16_t Pixel;
  **********************/
 
 static void disp_callback(uint32_t event);
+#if DISP_BEAM_RACING
+static void beam_line_event(void);
+static void beam_read(uint32_t* position, uint32_t* line);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 
+// Framebuffers in non-zeroed video memory, their contents are undefined until D/AVE2D clears them
 static Pixel lcd_buffer_1[MY_DISP_VER_RES][MY_DISP_HOR_RES]
-            __attribute__((section(".bss.lcd_frame_buf1"))) = {0};
+            __attribute__((section(".noinit.lcd_frame_buf1")));
+#if DISP_BUFFER_COUNT > 1
 static Pixel lcd_buffer_2[MY_DISP_VER_RES][MY_DISP_HOR_RES]
-            __attribute__((section(".bss.lcd_frame_buf2"))) = {0};
+            __attribute__((section(".noinit.lcd_frame_buf2")));
+#endif
 
 enum {
     BUFFER_1 = 0,
     BUFFER_2 = 1,
-    NUM_BUFFERS
+    NUM_BUFFERS = DISP_BUFFER_COUNT
 };
 
+#if DISP_BUFFER_COUNT > 1
 static Pixel* buffers[NUM_BUFFERS] = { (Pixel*)&lcd_buffer_1, (Pixel*)&lcd_buffer_2 };
+#else
+// The framebuffer that is scanned out is also the one drawn into
+static Pixel* buffers[NUM_BUFFERS] = { (Pixel*)&lcd_buffer_1 };
+#endif
 
 static uint8_t  current_buffer = BUFFER_1;
-static uint32_t frame_durations[NUM_BUFFERS] = { 1, 1 };
-static uint32_t switch_times[NUM_BUFFERS] = { 0, 0 };
+
+// Line 0 interrupts seen while disp_wait_frame_shown() waits
+static volatile uint32_t scanout_count;
+
+// Layer 2 of the CDC200, only scanned out while shown
+static const void* overlay_buffer;
+static uint32_t overlay_bytes;
+static bool overlay_shown;
+
+#if DISP_BEAM_RACING
+// Line interrupts at every beam_step lines of the active area and at its end. Position counts the lines scanned
+// since the first interrupt, it wraps after a day
+static uint32_t beam_step;
+static volatile uint32_t beam_armed;
+static volatile uint32_t beam_line;
+static volatile uint32_t beam_position;
+static volatile bool beam_synced;
+#endif
 
 extern ARM_DRIVER_CDC200 Driver_CDC200;
 static ARM_DRIVER_CDC200 *CDCdrv = &Driver_CDC200;
@@ -104,7 +133,7 @@ int display_init(void)
     }
 
     /* configure CDC controller */
-    ret = CDCdrv->Control(CDC200_CONFIGURE_DISPLAY, (uint32_t)disp_active_buffer());
+    ret = CDCdrv->Control(CDC200_CONFIGURE_DISPLAY, (uintptr_t)disp_active_buffer());
     if(ret != ARM_DRIVER_OK){
         printf("\r\n Error: CDC controller configuration failed\n");
         return ret;
@@ -120,11 +149,44 @@ int display_init(void)
     return ret;
 }
 
+int display_uninit(void)
+{
+    CDCdrv->Stop();
+
+    int ret = CDCdrv->PowerControl(ARM_POWER_OFF);
+    if(ret != ARM_DRIVER_OK){
+        printf("\r\n Error: CDC Power down failed\n");
+        return ret;
+    }
+
+    return CDCdrv->Uninitialize();
+}
+
 void disp_next_frame(void)
 {
     current_buffer = (current_buffer + 1) % NUM_BUFFERS;
 
-    CDCdrv->Control(CDC200_FRAMEBUF_UPDATE, (uint32_t)buffers[current_buffer]);
+    CDCdrv->Control(CDC200_FRAMEBUF_UPDATE, (uintptr_t)buffers[current_buffer]);
+}
+
+void disp_wait_frame_shown(void)
+{
+#if DISP_BEAM_RACING
+    if(beam_step){
+        /* Drawn behind the beam, the frame is complete on the panel at the end of the active area */
+        disp_beam_wait(MY_DISP_VER_RES);
+        return;
+    }
+#endif
+    /* The framebuffer address reloads in the vertical blanking, the next line 0 is its first scan-out */
+    uint32_t start = scanout_count;
+    if(CDCdrv->Control(CDC200_SCANLINE0_EVENT, 1) != ARM_DRIVER_OK){
+        return;
+    }
+    while(scanout_count == start){
+        __WFI();
+    }
+    CDCdrv->Control(CDC200_SCANLINE0_EVENT, 0);
 }
 
 void* disp_active_buffer(void)
@@ -137,10 +199,162 @@ void* disp_inactive_buffer(void)
     return buffers[(current_buffer + 1) % NUM_BUFFERS];
 }
 
+uint32_t disp_inactive_buffer_index(void)
+{
+    return (current_buffer + 1) % NUM_BUFFERS;
+}
+
+int disp_overlay_show(const void* buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+{
+    if(buffer == NULL || width == 0 || height == 0 || x + width > MY_DISP_HOR_RES || y + height > MY_DISP_VER_RES){
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    overlay_buffer = buffer;
+    overlay_bytes = width * height * sizeof(uint16_t);
+    disp_overlay_update();
+
+    /* The driver only sets up layer 1, layer 2 is programmed directly and loaded in the next vertical blanking */
+    cdc200_layer_regs_t* layer = &CDC200_REGS->LAYER[1];
+    const uint32_t column = CDC200_FIRST_ACTIVE_COLUMN + x;
+    const uint32_t line = CDC200_FIRST_ACTIVE_LINE + y;
+    layer->WINDOW_H = ((column + width - 1) << 16) | column;
+    layer->WINDOW_V = ((line + height - 1) << 16) | line;
+    layer->PIXEL_FORMAT = CDC200_LAYER_FORMAT_ARGB4444;
+    layer->CONST_ALPHA = 0xFF;
+    layer->BLEND = CDC200_BLEND_PIXEL_ALPHA;
+    layer->CFB_ADDR = (uintptr_t)buffer;
+    layer->CFB_LENGTH = CDC200_CFB_LENGTH(width * sizeof(uint16_t), width * sizeof(uint16_t));
+    layer->CFB_LINES = height;
+    layer->CONTROL = CDC200_LAYER_ENABLE;
+    CDC200_REGS->SHADOW_RELOAD = CDC200_SHADOW_RELOAD_VBLANK;
+
+    overlay_shown = true;
+    return ARM_DRIVER_OK;
+}
+
+void disp_overlay_update(void)
+{
+    /* The controller reads the overlay from memory at every scan-out */
+    if(overlay_buffer){
+        SCB_CleanDCache_by_Addr((void*)overlay_buffer, overlay_bytes);
+    }
+}
+
+void disp_overlay_hide(void)
+{
+    if(overlay_shown){
+        CDC200_REGS->LAYER[1].CONTROL = 0;
+        CDC200_REGS->SHADOW_RELOAD = CDC200_SHADOW_RELOAD_VBLANK;
+        overlay_shown = false;
+    }
+}
+
+bool disp_overlay_shown(void)
+{
+    return overlay_shown;
+}
+
+int disp_beam_start(uint32_t step)
+{
+#if DISP_BEAM_RACING
+    if(step == 0){
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    beam_armed = 0;
+    beam_synced = false;
+    int ret = CDCdrv->Control(CDC200_SCANLINE0_EVENT, 1);
+    if(ret != ARM_DRIVER_OK){
+        printf("\r\n Error: CDC line interrupt configuration failed\n");
+        return ret;
+    }
+
+    /* The driver only interrupts at its own line, move the interrupt to the first active row before following it */
+    CDC200_REGS->LINE_IRQ_POSITION = CDC200_FIRST_ACTIVE_LINE;
+    beam_step = step;
+
+    /* The position is known from the first line 0 on */
+    while(!beam_synced){
+        __WFI();
+    }
+    return ARM_DRIVER_OK;
+#else
+    (void)step;
+    return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
+}
+
+uint32_t disp_beam_position(void)
+{
+#if DISP_BEAM_RACING
+    return beam_position;
+#else
+    return 0;
+#endif
+}
+
+uint32_t disp_beam_wait(uint32_t line)
+{
+#if DISP_BEAM_RACING
+    uint32_t position;
+    uint32_t current;
+    beam_read(&position, &current);
+    if(current >= line){
+        return position - (current - line);
+    }
+
+    /* Ends at the first line interrupt at or after line, before the end of the scan-out */
+    uint32_t target = position + (line - current);
+    while((int32_t)(beam_position - target) < 0){
+        __WFI();
+    }
+    return target;
+#else
+    (void)line;
+    return 0;
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+#if DISP_BEAM_RACING
+/* The beam reached the armed line, count the lines since the last one and arm the next
+ */
+static void beam_line_event(void)
+{
+    uint32_t line = beam_armed;
+    if(beam_synced){
+        beam_position += (line + DISP_SCAN_LINES - beam_line) % DISP_SCAN_LINES;
+    }else{
+        beam_position = 0;
+        beam_synced = true;
+    }
+    beam_line = line;
+
+    /* Every step of the active area, the end of it, then line 0 of the next scan-out */
+    uint32_t next = 0;
+    if(line < MY_DISP_VER_RES){
+        next = line + beam_step < MY_DISP_VER_RES ? line + beam_step : MY_DISP_VER_RES;
+    }
+    beam_armed = next;
+    CDC200_REGS->LINE_IRQ_POSITION = CDC200_FIRST_ACTIVE_LINE + next;
+}
+
+/* Position and line of the same interrupt
+ */
+static void beam_read(uint32_t* position, uint32_t* line)
+{
+    do{
+        *position = beam_position;
+        *line = beam_line;
+    }while(*position != beam_position);
+}
+#endif
+
+
 /* Display errors handler
  */
 static void disp_callback(uint32_t event)
@@ -150,4 +364,15 @@ static void disp_callback(uint32_t event)
         // Transfer Error: Received Hardware error.
         __BKPT(0);
     }
+    if(event & ARM_CDC_SCANLINE0_EVENT)
+    {
+#if DISP_BEAM_RACING
+        if(beam_step)
+        {
+            beam_line_event();
+            return;
+        }
+#endif
+        scanout_count++;
+    }
 }
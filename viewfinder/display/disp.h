@@ -13,7 +13,9 @@ extern "C" {
 /*********************
  *      INCLUDES
  *********************/
+#include <stdbool.h>
 #include <stdint.h>
+#include <RTE_Device.h>
 
 /*********************
  *      DEFINES
@@ -21,6 +23,36 @@ extern "C" {
 #define MY_DISP_HOR_RES      (RTE_PANEL_HACTIVE_TIME)
 #define MY_DISP_VER_RES      (RTE_PANEL_VACTIVE_LINE)
 
+/* Framebuffer color format of the CDC200 configuration as an AIPL color format, and its bytes per pixel */
+#if RTE_CDC200_PIXEL_FORMAT == 0
+#define DISP_COLOR_FORMAT    (AIPL_COLOR_ARGB8888)
+#define DISP_PIXEL_SIZE      (4)
+#elif RTE_CDC200_PIXEL_FORMAT == 1
+#define DISP_COLOR_FORMAT    (AIPL_COLOR_RGB888)
+#define DISP_PIXEL_SIZE      (3)
+#elif RTE_CDC200_PIXEL_FORMAT == 2
+#define DISP_COLOR_FORMAT    (AIPL_COLOR_RGB565)
+#define DISP_PIXEL_SIZE      (2)
+#else
+#error "CDC200 Unsupported color format"
+#endif
+
+/* Render into the one framebuffer that is scanned out, behind the beam, instead of flipping two (disp_beam_*).
+ * The line interrupt is moved along the scan-out with the CDC200 register of display/cdc200_regs.h */
+#ifndef DISP_BEAM_RACING
+#define DISP_BEAM_RACING     (0)
+#endif
+
+/* Number of framebuffers the display flips between */
+#if DISP_BEAM_RACING
+#define DISP_BUFFER_COUNT    (1)
+#else
+#define DISP_BUFFER_COUNT    (2)
+#endif
+
+/* Lines of one scan-out including the blanking, rows 0 to MY_DISP_VER_RES - 1 are the active ones */
+#define DISP_SCAN_LINES      (RTE_PANEL_VACTIVE_LINE + RTE_PANEL_VFP_LINE + RTE_PANEL_VSYNC_LINE + RTE_PANEL_VBP_LINE)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -31,18 +63,51 @@ extern "C" {
 /* Initialize low level display driver */
 int display_init(void);
 
+/* Stop and power down the display controller */
+int display_uninit(void);
+
 /* Set next frame display duration */
 void disp_set_next_frame_duration(uint32_t duration);
 
 /* Display the next prerendered frame frame buffer */
 void disp_next_frame(void);
 
+/* Wait until the panel scans out the framebuffer of the last disp_next_frame(), or the first one after display_init() */
+void disp_wait_frame_shown(void);
+
 /* Get pointer to display active buffer */
 void* disp_active_buffer(void);
 
 /* Get pointer to display inactive buffer */
 void* disp_inactive_buffer(void);
 
+/* Get index of display inactive buffer, 0 to DISP_BUFFER_COUNT - 1 */
+uint32_t disp_inactive_buffer_index(void);
+
+/* Show width x height ARGB4444 pixels at x, y on layer 2 of the CDC200, blended over the framebuffers at scan-out
+ * from the next frame on. The buffer stays in use until disp_overlay_hide() */
+int disp_overlay_show(const void* buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
+/* Write back the overlay buffer after its content changed */
+void disp_overlay_update(void);
+
+/* Stop showing the overlay layer */
+void disp_overlay_hide(void);
+
+/* Check if the overlay layer is shown */
+bool disp_overlay_shown(void);
+
+/* Follow the beam with a CDC200 line interrupt at every step lines of the active area and at its end.
+ * Returns ARM_DRIVER_ERROR_UNSUPPORTED without line interrupts */
+int disp_beam_start(uint32_t step);
+
+/* Lines scanned out since disp_beam_start(), at the last line interrupt. Wraps, compare differences */
+uint32_t disp_beam_position(void);
+
+/* Wait until the beam has passed line in the current scan-out, returns at once if it already has. Without an
+ * interrupt at line the wait ends at the next one. Returns the position at which the beam passed line */
+uint32_t disp_beam_wait(uint32_t line);
+
 /**********************
  *      MACROS
  **********************/
@@ -20,6 +20,7 @@
 /*********************
  *      DEFINES
  *********************/
+#define BACKGROUND_COLOR (0x00fefefe)
 
 /**********************
  *      TYPEDEFS
@@ -31,16 +32,76 @@ typedef struct {
     uint32_t pitch;
     uint32_t width;
     uint32_t height;
+    uint32_t dst_width;     /* Size in the framebuffer, scaled if it differs from the image */
+    uint32_t dst_height;
+    uint32_t step_x;        /* Texels per framebuffer pixel in 16.16, 0 derives them from the sizes */
+    uint32_t step_y;
+    bool rotate_180;
 } graph_image_t;
 
+/* Framebuffer area, inclusive, empty if x1 < x0 */
+typedef struct {
+    int32_t x0;
+    int32_t y0;
+    int32_t x1;
+    int32_t y1;
+} graph_rect_t;
+
+/* Texture and mapping last set in the draw context */
+typedef struct {
+    bool valid;
+    uint32_t mode;
+    const void* image;
+    uint32_t pitch;
+    uint32_t width;
+    uint32_t height;
+    d2_point x;
+    d2_point y;
+    d2_s32 u0;
+    d2_s32 v0;
+    d2_s32 dxu;
+    d2_s32 dyv;
+} graph_draw_state_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void dave2d_framebuffer(d2_device* handle, void* buffer);
+static d2_context* draw_context_select(d2_device* handle);
 static void dave2d_image_draw(uint32_t format, const graph_image_t* image);
+static void damage_all(graph_rect_t area);
+static void damage_frame(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+static graph_rect_t rect_union(graph_rect_t a, graph_rect_t b);
+static graph_rect_t rect_intersect(graph_rect_t a, graph_rect_t b);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+static const graph_rect_t full_screen = {0, 0, RTE_PANEL_HACTIVE_TIME - 1, RTE_PANEL_VACTIVE_LINE - 1};
+static const graph_rect_t no_area = {0, 0, -1, -1};
+
+/* Area of each framebuffer that no longer shows the current content, the framebuffers start undefined */
+static graph_rect_t damage[DISP_BUFFER_COUNT] = {
+    {0, 0, RTE_PANEL_HACTIVE_TIME - 1, RTE_PANEL_VACTIVE_LINE - 1},
+#if DISP_BUFFER_COUNT > 1
+    {0, 0, RTE_PANEL_HACTIVE_TIME - 1, RTE_PANEL_VACTIVE_LINE - 1}
+#endif
+};
+/* Frame area of the last frame drawn into each framebuffer */
+static graph_rect_t frame_area[DISP_BUFFER_COUNT] = {
+    {0, 0, -1, -1},
+#if DISP_BUFFER_COUNT > 1
+    {0, 0, -1, -1}
+#endif
+};
+/* Area cleared and redrawn in the current frame */
+static graph_rect_t frame_clip = {0, 0, RTE_PANEL_HACTIVE_TIME - 1, RTE_PANEL_VACTIVE_LINE - 1};
+/* Draws are clipped to this area, the frame area or the band of it being drawn */
+static graph_rect_t draw_clip = {0, 0, RTE_PANEL_HACTIVE_TIME - 1, RTE_PANEL_VACTIVE_LINE - 1};
+
+/* Own D/AVE2D context of the image draws, AIPL kernels do not change its state between frames */
+static d2_context* draw_context;
+static graph_draw_state_t draw_state;
 
 /**********************
  *      MACROS
@@ -50,19 +111,88 @@ static void dave2d_image_draw(uint32_t format, const graph_image_t* image);
  *   GLOBAL FUNCTIONS
  **********************/
 
+bool aipl_image_view(aipl_image_t* view, const aipl_image_t* image,
+                     uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+{
+    if (x + width > image->width || y + height > image->height)
+        return false;
+
+    *view = *image;
+    view->data = (uint8_t*)image->data + (y * image->pitch + x) * aipl_color_format_depth(image->format) / 8;
+    view->width = width;
+    view->height = height;
+    return true;
+}
+
 void aipl_dave2d_prepare(void)
 {
     d2_device* handle = aipl_dave2d_handle();
     /* Prepare frame buffer */
-    d2_framebuffer(handle, disp_inactive_buffer(),
-                    RTE_PANEL_HACTIVE_TIME,
-                    RTE_PANEL_HACTIVE_TIME,
-                    RTE_PANEL_VACTIVE_LINE, d2_mode_rgb565);
+    dave2d_framebuffer(handle, disp_inactive_buffer());
     /* Set background */
-    d2_clear(handle, 0x00fefefe);
+    d2_clear(handle, BACKGROUND_COLOR);
+
+    /* Any other content, the next damage-tracked frame of each framebuffer draws everything */
+    frame_clip = full_screen;
+    draw_clip = full_screen;
+    damage_all(full_screen);
+}
+
+void aipl_dave2d_prepare_damage(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+{
+    damage_frame(x, y, width, height);
+
+    d2_device* handle = aipl_dave2d_handle();
+    dave2d_framebuffer(handle, disp_inactive_buffer());
+    d2_cliprect(handle, (d2_border)draw_clip.x0, (d2_border)draw_clip.y0,
+                (d2_border)draw_clip.x1, (d2_border)draw_clip.y1);
+    d2_clear(handle, BACKGROUND_COLOR);
+}
+
+void aipl_dave2d_prepare_bands(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+{
+    damage_frame(x, y, width, height);
+
+    dave2d_framebuffer(aipl_dave2d_handle(), disp_inactive_buffer());
+}
+
+bool aipl_dave2d_prepare_band(uint32_t y, uint32_t height)
+{
+    graph_rect_t rows = {0, (int32_t)y, RTE_PANEL_HACTIVE_TIME - 1, (int32_t)(y + height) - 1};
+    draw_clip = rect_intersect(frame_clip, rows);
+    if (draw_clip.x1 < draw_clip.x0 || draw_clip.y1 < draw_clip.y0)
+        return false;
+
+    d2_device* handle = aipl_dave2d_handle();
+    d2_cliprect(handle, (d2_border)draw_clip.x0, (d2_border)draw_clip.y0,
+                (d2_border)draw_clip.x1, (d2_border)draw_clip.y1);
+    d2_clear(handle, BACKGROUND_COLOR);
+    return true;
+}
+
+void aipl_dave2d_damage(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+{
+    graph_rect_t area = {(int32_t)x, (int32_t)y, (int32_t)(x + width) - 1, (int32_t)(y + height) - 1};
+    damage_all(area);
+}
+
+uint32_t aipl_dave2d_drawn_pixels(void)
+{
+    if (frame_clip.x1 < frame_clip.x0 || frame_clip.y1 < frame_clip.y0)
+        return 0;
+
+    return (uint32_t)((frame_clip.x1 - frame_clip.x0 + 1) * (frame_clip.y1 - frame_clip.y0 + 1));
 }
 
 void aipl_dave2d_render(void)
+{
+    aipl_dave2d_finish();
+
+    /* Switch to the next display buffer */
+    disp_next_frame();
+}
+
+void aipl_dave2d_finish(void)
 {
     d2_device* handle = aipl_dave2d_handle();
 
@@ -72,9 +202,20 @@ void aipl_dave2d_render(void)
     d2_startframe(handle);
     /* Wait until the render finishes */
     d2_endframe(handle);
+}
 
-    /* Switch to the next display buffer */
-    disp_next_frame();
+void aipl_dave2d_clear(void* buffer, uint32_t color)
+{
+    d2_device* handle = aipl_dave2d_handle();
+
+    dave2d_framebuffer(handle, buffer);
+    d2_clear(handle, color);
+
+    aipl_dave2d_finish();
+
+    frame_clip = full_screen;
+    draw_clip = full_screen;
+    damage_all(full_screen);
 }
 
 void aipl_image_draw(uint32_t x, uint32_t y, const aipl_image_t* image)
@@ -85,7 +226,9 @@ void aipl_image_draw(uint32_t x, uint32_t y, const aipl_image_t* image)
         .image = image->data,
         .pitch = image->pitch,
         .width = image->width,
-        .height = image->height
+        .height = image->height,
+        .dst_width = image->width,
+        .dst_height = image->height
     };
 
     // If format is not supported by D/AVE2D, convert it to RGB565
@@ -115,6 +258,7 @@ void aipl_image_draw(uint32_t x, uint32_t y, const aipl_image_t* image)
         }
 
         img.image = cnv_img.data;
+        img.pitch = cnv_img.pitch;
 
         dave2d_image_draw(d2_mode_rgb565, &img);
 
@@ -122,6 +266,29 @@ void aipl_image_draw(uint32_t x, uint32_t y, const aipl_image_t* image)
     }
 }
 
+void aipl_image_draw_scaled(uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t step_x,
+                            uint32_t step_y, const aipl_image_t* image, bool rotate_180)
+{
+    if (!aipl_dave2d_format_supported(image->format) || width == 0 || height == 0)
+        return;
+
+    graph_image_t img = {
+        .x = x,
+        .y = y,
+        .image = image->data,
+        .pitch = image->pitch,
+        .width = image->width,
+        .height = image->height,
+        .dst_width = width,
+        .dst_height = height,
+        .step_x = step_x,
+        .step_y = step_y,
+        .rotate_180 = rotate_180
+    };
+
+    dave2d_image_draw(aipl_dave2d_format_to_mode(image->format), &img);
+}
+
 void aipl_image_draw_clut(uint32_t x, uint32_t y, const aipl_image_t* image)
 {
     if (image->format != AIPL_COLOR_ALPHA8)
@@ -133,7 +300,9 @@ void aipl_image_draw_clut(uint32_t x, uint32_t y, const aipl_image_t* image)
         .image = image->data,
         .pitch = image->pitch,
         .width = image->width,
-        .height = image->height
+        .height = image->height,
+        .dst_width = image->width,
+        .dst_height = image->height
     };
 
     if (aipl_dave2d_format_supported(image->format))
@@ -149,48 +318,188 @@ void aipl_dave2d_set_clut(const uint8_t* clut, aipl_color_format_t format)
 
     d2_device* handle = aipl_dave2d_handle();
 
+    /* The CLUT is context state */
+    d2_context* previous = draw_context_select(handle);
     d2_s32 ret = d2_settexclut(handle, (d2_color*)clut);
-    if (ret != D2_OK)
+    if (ret == D2_OK)
     {
-        return;
+        d2_settexclut_format(handle, aipl_dave2d_format_to_mode(format));
     }
-
-    d2_settexclut_format(handle, aipl_dave2d_format_to_mode(format));
+    d2_selectcontext(handle, previous);
 }
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+/* Framebuffer in the panel format of the CDC200 configuration, the pitch is in pixels */
+static void dave2d_framebuffer(d2_device* handle, void* buffer)
+{
+    d2_framebuffer(handle, buffer,
+                    RTE_PANEL_HACTIVE_TIME,
+                    RTE_PANEL_HACTIVE_TIME,
+                    RTE_PANEL_VACTIVE_LINE, aipl_dave2d_format_to_mode(DISP_COLOR_FORMAT));
+}
+
+/* Select the draw context, created with the state shared by all image draws on first use, returns the previous context */
+static d2_context* draw_context_select(d2_device* handle)
+{
+    d2_context* previous = d2_getcontext(handle, -1);
+
+    if (draw_context == NULL)
+    {
+        draw_context = d2_newcontext(handle);
+        if (draw_context == NULL)
+        {
+            /* Draw in the current context and set the whole state every time */
+            draw_state.valid = false;
+            return previous;
+        }
+        d2_selectcontext(handle, draw_context);
+        d2_settexturemode(handle, d2_tm_filter);
+        d2_setfillmode(handle, d2_fm_texture);
+        d2_setblendmode(handle, d2_bm_alpha, d2_bm_one_minus_alpha);
+        d2_setalphablendmode(handle, d2_bm_one, d2_bm_one_minus_alpha);
+        return previous;
+    }
+
+    d2_selectcontext(handle, draw_context);
+    return previous;
+}
+
 static void dave2d_image_draw(uint32_t mode, const graph_image_t* image)
 {
-    int32_t dsize = image->pitch * image->height * aipl_dave2d_mode_px_size(mode);
+    /* Only the rows of a view, not the rest of the image after its last row */
+    int32_t dsize = ((image->height - 1) * image->pitch + image->width) * aipl_dave2d_mode_px_size(mode);
     SCB_CleanInvalidateDCache_by_Addr(image->image, dsize);
 
+    /* Parts outside the area redrawn in this frame are already in the framebuffer */
+    graph_rect_t area = {(int32_t)image->x, (int32_t)image->y,
+                         (int32_t)(image->x + image->dst_width) - 1,
+                         (int32_t)(image->y + image->dst_height) - 1};
+    graph_rect_t clip = rect_intersect(area, draw_clip);
+    if (clip.x1 < clip.x0 || clip.y1 < clip.y0)
+        return;
+
     d2_device* handle = aipl_dave2d_handle();
+    d2_context* previous = draw_context_select(handle);
 
-    d2_cliprect(handle, (d2_border)image->x, (d2_border)image->y,
-                (d2_border)image->x + image->width - 1,
-                (d2_border)image->y + image->height - 1);
+    d2_cliprect(handle, (d2_border)clip.x0, (d2_border)clip.y0,
+                (d2_border)clip.x1, (d2_border)clip.y1);
 
-    d2_u8 alpha_mode = aipl_dave2d_mode_has_alpha(mode) ? d2_to_copy : d2_to_one;
-    d2_settextureoperation(handle, alpha_mode, d2_to_copy, d2_to_copy, d2_to_copy);
+    /* Only what differs from the last draw in the context is set, a new camera frame only changes the texture address */
+    if (!draw_state.valid || draw_state.mode != mode)
+    {
+        d2_u8 alpha_mode = aipl_dave2d_mode_has_alpha(mode) ? d2_to_copy : d2_to_one;
+        d2_settextureoperation(handle, alpha_mode, d2_to_copy, d2_to_copy, d2_to_copy);
+    }
 
-    d2_settexture(handle, image->image, image->pitch, image->width,
-                  image->height, mode);
+    if (!draw_state.valid || draw_state.mode != mode || draw_state.image != image->image ||
+        draw_state.pitch != image->pitch || draw_state.width != image->width || draw_state.height != image->height)
+    {
+        d2_settexture(handle, image->image, image->pitch, image->width,
+                      image->height, mode);
+    }
 
-    d2_settexturemode(handle, d2_tm_filter);
-    d2_setfillmode(handle, d2_fm_texture);
-    d2_setblendmode(handle, d2_bm_alpha, d2_bm_one_minus_alpha);
-    d2_setalphablendmode(handle, d2_bm_one, d2_bm_one_minus_alpha);
+    if (draw_context == NULL)
+    {
+        d2_settexturemode(handle, d2_tm_filter);
+        d2_setfillmode(handle, d2_fm_texture);
+        d2_setblendmode(handle, d2_bm_alpha, d2_bm_one_minus_alpha);
+        d2_setalphablendmode(handle, d2_bm_one, d2_bm_one_minus_alpha);
+    }
 
-    d2_settexturemapping(handle, D2_FIX4(image->x), D2_FIX4(image->y),
-                         D2_FIX16(0), D2_FIX16(0),
-                         D2_FIX16(1), D2_FIX16(0),
-                         D2_FIX16(0), D2_FIX16(1));
+    /* Texels per framebuffer pixel, a 180 degree rotation walks the texture backwards from the last texel */
+    d2_s32 dxu = image->step_x ? (d2_s32)image->step_x : (d2_s32)(((int64_t)image->width << 16) / image->dst_width);
+    d2_s32 dyv = image->step_y ? (d2_s32)image->step_y : (d2_s32)(((int64_t)image->height << 16) / image->dst_height);
+    d2_s32 u0 = D2_FIX16(0);
+    d2_s32 v0 = D2_FIX16(0);
+    if (image->rotate_180)
+    {
+        u0 = D2_FIX16(image->width) - 1;
+        v0 = D2_FIX16(image->height) - 1;
+        dxu = -dxu;
+        dyv = -dyv;
+    }
+
+    d2_point x = D2_FIX4(image->x);
+    d2_point y = D2_FIX4(image->y);
+    if (!draw_state.valid || draw_state.x != x || draw_state.y != y || draw_state.u0 != u0 ||
+        draw_state.v0 != v0 || draw_state.dxu != dxu || draw_state.dyv != dyv)
+    {
+        d2_settexturemapping(handle, x, y,
+                             u0, v0,
+                             dxu, D2_FIX16(0),
+                             D2_FIX16(0), dyv);
+    }
 
     d2_renderquad(handle, D2_FIX4(image->x), D2_FIX4(image->y),
-                  D2_FIX4(image->x + image->width - 1), D2_FIX4(image->y),
-                  D2_FIX4(image->x + image->width - 1), D2_FIX4(image->y + image->height - 1),
-                  D2_FIX4(image->x), D2_FIX4(image->y + image->height - 1),
+                  D2_FIX4(image->x + image->dst_width - 1), D2_FIX4(image->y),
+                  D2_FIX4(image->x + image->dst_width - 1), D2_FIX4(image->y + image->dst_height - 1),
+                  D2_FIX4(image->x), D2_FIX4(image->y + image->dst_height - 1),
                   0);
+
+    draw_state = (graph_draw_state_t){
+        .valid = draw_context != NULL,
+        .mode = mode,
+        .image = image->image,
+        .pitch = image->pitch,
+        .width = image->width,
+        .height = image->height,
+        .x = x,
+        .y = y,
+        .u0 = u0,
+        .v0 = v0,
+        .dxu = dxu,
+        .dyv = dyv
+    };
+    d2_selectcontext(handle, previous);
+}
+
+static void damage_all(graph_rect_t area)
+{
+    for (uint32_t i = 0; i < DISP_BUFFER_COUNT; i++)
+    {
+        damage[i] = rect_union(damage[i], area);
+    }
+}
+
+/* Frame area of a damage-tracked frame in the inactive framebuffer */
+static void damage_frame(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+{
+    uint32_t buffer = disp_inactive_buffer_index();
+    graph_rect_t area = {(int32_t)x, (int32_t)y, (int32_t)(x + width) - 1, (int32_t)(y + height) - 1};
+
+    /* The frame area of the last frame in this framebuffer is cleared too, in case the frame moved or shrank */
+    frame_clip = rect_intersect(rect_union(rect_union(damage[buffer], frame_area[buffer]), area), full_screen);
+    draw_clip = frame_clip;
+    damage[buffer] = no_area;
+    frame_area[buffer] = area;
+}
+
+/* Bounding box of both, an empty rectangle adds nothing */
+static graph_rect_t rect_union(graph_rect_t a, graph_rect_t b)
+{
+    if (a.x1 < a.x0 || a.y1 < a.y0)
+        return b;
+    if (b.x1 < b.x0 || b.y1 < b.y0)
+        return a;
+
+    graph_rect_t r = {
+        a.x0 < b.x0 ? a.x0 : b.x0,
+        a.y0 < b.y0 ? a.y0 : b.y0,
+        a.x1 > b.x1 ? a.x1 : b.x1,
+        a.y1 > b.y1 ? a.y1 : b.y1
+    };
+    return r;
+}
+
+static graph_rect_t rect_intersect(graph_rect_t a, graph_rect_t b)
+{
+    graph_rect_t r = {
+        a.x0 > b.x0 ? a.x0 : b.x0,
+        a.y0 > b.y0 ? a.y0 : b.y0,
+        a.x1 < b.x1 ? a.x1 : b.x1,
+        a.y1 < b.y1 ? a.y1 : b.y1
+    };
+    return r;
 }
@@ -31,12 +31,46 @@ extern "C" {
  * GLOBAL PROTOTYPES
  **********************/
 
+/* View of the width x height part of the image at x, y: the data pointer moves, the pitch stays the one of the image.
+ * No pixels are copied, the view is valid as long as the image. Returns false if the part is not inside the image */
+bool aipl_image_view(aipl_image_t* view, const aipl_image_t* image,
+                     uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
 void aipl_dave2d_prepare(void);
 
+/* Prepare a damage-tracked frame that redraws x, y, width x height of the inactive framebuffer, e.g. the camera image.
+ * Only that area and the damage of this framebuffer are cleared, and draws up to aipl_dave2d_render() are clipped
+ * to them: static content drawn every frame only costs fill-rate where it needs repainting */
+void aipl_dave2d_prepare_damage(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
+/* Like aipl_dave2d_prepare_damage(), but nothing is cleared yet: the frame is drawn in bands of rows, each with
+ * aipl_dave2d_prepare_band(), the draws and aipl_dave2d_finish(). For drawing into the framebuffer being scanned out */
+void aipl_dave2d_prepare_bands(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
+/* Clear rows y to y + height - 1 of the frame area and clip the draws up to aipl_dave2d_finish() to them.
+ * Returns false if the band has nothing to redraw */
+bool aipl_dave2d_prepare_band(uint32_t y, uint32_t height);
+
+/* Static content in the area changed, it is redrawn in every framebuffer by the next damage-tracked frames */
+void aipl_dave2d_damage(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
+/* Framebuffer pixels cleared and drawable in the current frame, the whole panel after aipl_dave2d_prepare() */
+uint32_t aipl_dave2d_drawn_pixels(void);
+
 void aipl_dave2d_render(void);
 
+/* Render the commands since aipl_dave2d_prepare() and wait, without showing the framebuffer */
+void aipl_dave2d_finish(void);
+
+void aipl_dave2d_clear(void* buffer, uint32_t color);
+
 void aipl_image_draw(uint32_t x, uint32_t y, const aipl_image_t* image);
 
+/* Draw the image scaled to width x height, D/AVE2D formats only. step_x and step_y are the texels per framebuffer
+ * pixel in 16.16 fixed point, as computed once by the layout, 0 derives them from the sizes */
+void aipl_image_draw_scaled(uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t step_x,
+                            uint32_t step_y, const aipl_image_t* image, bool rotate_180);
+
 void aipl_image_draw_clut(uint32_t x, uint32_t y, const aipl_image_t* image);
 
 void aipl_dave2d_set_clut(const uint8_t* clut, aipl_color_format_t format);
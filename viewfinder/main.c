@@ -20,26 +20,47 @@
 #include "dave_d0lib.h"
 
 // Alif Image Processing Library
-#include "aipl_color_correction.h"
-#include "aipl_crop.h"
 #include "aipl_image.h"
-#include "aipl_lut_transform.h"
-#include "aipl_resize.h"
-#include "aipl_rotate.h"
 #include "board_config.h"
 #include "camera.h"
 #include "disp.h"
 #include "image.h"
+#include "pipeline.h"
 
+#include "dvfs.h"
+#include "energy_model.h"
+#include "frame_governor.h"
 #include "power_management.h"
 #include "se_services_port.h"
 #include "alif_logo.h"
 
+#if defined(CAMERA_REPLAY)
+#include "replay_source.h"
+#endif
+#if defined(CAMERA_TEST_PATTERN)
+#include "pattern_source.h"
+#endif
+#if defined(KERNEL_BENCH)
+#include "kernel_bench.h"
+#endif
+#if defined(STANDBY_VIEWFINDER)
+#include "standby.h"
+#endif
+#if defined(VIEWFINDER_RTOS)
+#include "pipeline_rtos.h"
+#endif
+#if defined(DUAL_CORE)
+#include "core_link.h"
+#endif
+#if defined(DUAL_CORE_SPLIT)
+#include "split_convert.h"
+#endif
+
 extern void clk_init();  // time.h clock functionality (from retarget.c)
 
-// DAVE heap
+// DAVE heap, placed in non-zeroed video memory to keep it out of the startup clear
 #define D1_HEAP_SIZE 0x002E0000
-static uint8_t d0_heap[D1_HEAP_SIZE] __attribute__((section(".bss.video_mem_heap")));
+static uint8_t d0_heap[D1_HEAP_SIZE] __attribute__((section(".noinit.video_mem_heap")));
 
 // Check if UART trace is disabled
 #if !defined(DISABLE_UART_TRACE)
@@ -67,8 +88,112 @@ static ARM_DRIVER_GPIO* red_port = &ARM_Driver_GPIO_(BOARD_LEDRGB1_R_GPIO_PORT);
 #define PRINT_INTERVAL_CLOCKS (PRINT_INTERVAL_SEC * CLOCKS_PER_SEC)
 extern uint32_t SystemCoreClock;
 
+// Frame rate the DVFS governor scales the CPU clock for, 0 keeps the run profile clock
+#ifndef DVFS_TARGET_FPS
+#define DVFS_TARGET_FPS (0)
+#endif
+
+// Fixed frame rate with idle sleep between the frames, 0 runs the frames back to back
+#ifndef FRAME_GOVERNOR_FPS
+#define FRAME_GOVERNOR_FPS (0)
+#endif
+
+#if defined(VIEWFINDER_RTOS) && (DVFS_TARGET_FPS || FRAME_GOVERNOR_FPS || defined(STANDBY_VIEWFINDER))
+#error "The RTOS pipeline does not support DVFS, the frame governor or standby"
+#endif
+
+#if defined(DUAL_CORE) && (defined(VIEWFINDER_RTOS) || defined(STANDBY_VIEWFINDER))
+#error "The dual-core pipeline does not support the RTOS build or standby"
+#endif
+
+#if defined(DUAL_CORE_SPLIT) && (defined(DUAL_CORE) || defined(VIEWFINDER_RTOS) || defined(STANDBY_VIEWFINDER))
+#error "The split build does not support the dual-core pipeline, the RTOS build or standby"
+#endif
+
 #include "pinconf.h"
+
+static void set_error_led(void) {
+    red_port->SetValue(BOARD_LEDRGB1_R_GPIO_PIN, GPIO_PIN_OUTPUT_STATE_HIGH);
+}
+
+#if !defined(DUAL_CORE) || defined(CORE_M55_HE)
+static int init_camera(void) {
+#if defined(CAMERA_REPLAY)
+    // Feed recorded frames instead of the CPI camera to get repeatable timings
+    camera_set_frame_source(&replay_frame_source);
+#elif defined(CAMERA_TEST_PATTERN)
+    // Generated frames without capture cost to measure the processing and display path alone
+    camera_set_frame_source(&pattern_frame_source);
+#endif
+    return camera_init();
+}
+#endif
+
+#if defined(DUAL_CORE) && defined(CORE_M55_HE)
+// M55-HE image of the dual-core build: capture only, the M55-HP image processes and shows the frames
+static void capture_core_main(void) {
+    int ret = init_camera();
+    if (ret == ARM_DRIVER_OK) {
+        core_link_capture_loop();
+    }
+
+    // Set RED LED in error case
+    set_error_led();
+    while (1) {
+        __WFI();
+    }
+}
+#endif
+
+// Logo splash in the middle of the screen, shown while the camera is configured
+static void show_splash(void) {
+    const aipl_image_t *logo = get_alif_logo();
+    aipl_dave2d_prepare();
+    aipl_image_draw_clut((MY_DISP_HOR_RES - logo->width) / 2, (MY_DISP_VER_RES - logo->height) / 2, logo);
+    aipl_dave2d_render();
+}
+
+#if defined(BOOT_NOINIT_CLEAR)
+// Bounds of the .noinit video memory from the linker script
+extern uint32_t __noinit_sram0_start__, __noinit_sram0_end__, __noinit_sram1_start__, __noinit_sram1_end__;
+
+// Clear the .noinit video memory with the word loop of the startup zero table. The cycles it takes are what the
+// placement saves between reset and main(), the startup code cleared these sections before they were NOLOAD
+static uint32_t boot_noinit_clear(uint32_t *bytes) {
+    uint32_t start = ARM_PMU_Get_CCNTR();
+    for (volatile uint32_t *p = &__noinit_sram0_start__; p < &__noinit_sram0_end__; p++) {
+        *p = 0;
+    }
+    for (volatile uint32_t *p = &__noinit_sram1_start__; p < &__noinit_sram1_end__; p++) {
+        *p = 0;
+    }
+    uint32_t cycles = ARM_PMU_Get_CCNTR() - start;
+
+    *bytes = (uint32_t)((uint8_t *)&__noinit_sram0_end__ - (uint8_t *)&__noinit_sram0_start__)
+           + (uint32_t)((uint8_t *)&__noinit_sram1_end__ - (uint8_t *)&__noinit_sram1_start__);
+    return cycles;
+}
+#endif
+
 int main(void) {
+    // Enable PMU cycle counter for measurements
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    ARM_PMU_Enable();
+    ARM_PMU_CNTR_Enable(PMU_CNTENSET_CCNTR_ENABLE_Msk);
+    ARM_PMU_CYCCNT_Reset();
+
+#if defined(BOOT_NOINIT_CLEAR)
+    // Still at the clock the startup code runs at, before anything uses the video memory
+    uint32_t noinit_bytes;
+    uint32_t noinit_cycles = boot_noinit_clear(&noinit_bytes);
+    uint32_t noinit_clock = SystemCoreClock;
+#endif
+
+#if !defined(VIEWFINDER_RTOS)
+    // For time.h clock(), the RTOS kernel takes SysTick over in the RTOS build. It counts milliseconds at any core
+    // clock, the boot time until the first frame is timed with it
+    clk_init();
+#endif
 
     int32_t board_init_ret = board_pins_config();
     if(board_init_ret) {
@@ -97,7 +222,14 @@ int main(void) {
     red_port->SetDirection(BOARD_LEDRGB1_R_GPIO_PIN, GPIO_PIN_DIRECTION_OUTPUT);
 
     /* Enable MIPI power */
+#if defined(STANDBY_VIEWFINDER)
+    // A timer wake-up only shows a single frame, skip the splash and what the SE still has from before the off state
+    bool splash = standby_init() != STANDBY_WAKE_TIMER;
+    bool pm_ok = splash ? init_power_management() : resume_power_management();
+#else
+    bool splash = true;
     bool pm_ok = init_power_management();
+#endif
     if (!pm_ok) {
         printf("\r\nError: power management init failed.\r\n");
         __BKPT(0);
@@ -107,6 +239,21 @@ int main(void) {
     tracelib_init(NULL, uart_callback);
 #endif
 
+#if defined(BOOT_NOINIT_CLEAR)
+    printf("Boot: zeroing the %uKB of .noinit video memory adds %u.%03ums to reset-to-main()\r\n",
+           (unsigned)(noinit_bytes / 1024), (unsigned)((uint64_t)noinit_cycles * 1000 / noinit_clock),
+           (unsigned)((uint64_t)noinit_cycles * 1000000 / noinit_clock % 1000));
+#endif
+
+#if defined(DUAL_CORE) && defined(CORE_M55_HE)
+    capture_core_main();
+#endif
+
+#if defined(DUAL_CORE_SPLIT) && defined(CORE_M55_HE)
+    // M55-HE image of the split build: convert the bottom part of the frames of the M55-HP image
+    split_convert_worker();
+#endif
+
 #if (D1_MEM_ALLOC == D1_MALLOC_D0LIB)
     /*-------------------------
      * Initialize D/AVE D0 heap
@@ -122,176 +269,131 @@ int main(void) {
         __BKPT(0);
     }
 
-    clk_init();  // for time.h clock()
+#if defined(KERNEL_BENCH)
+    // Kernel benchmark image: measure the image kernels instead of running the viewfinder
+    kernel_bench_run();
+    while (1) {
+        __WFI();
+    }
+#endif
 
-    // Init camera
-    int ret = camera_init();
-    if (ret != ARM_DRIVER_OK) {
-        __BKPT(1);
-    } else {
-        // Camera init OK --> init display
-        ret = display_init();
+    /*
+     * Boot sequence: bring up the panel before the camera and show the logo
+     * splash, then configure the camera sensor while the display controller
+     * scans out the splash. The slow sensor configuration over I2C no longer
+     * keeps the panel dark.
+     */
+    // The framebuffers are not cleared at reset, clear the one scanned out first
+    aipl_dave2d_clear(disp_active_buffer(), 0x00000000);
 
-        if (ret != ARM_DRIVER_OK) {
-            __BKPT(2);
-        }
+    int ret = display_init();
+    if (ret != ARM_DRIVER_OK) {
+        __BKPT(2);
     }
 
     // Set Logo CLUT
     aipl_dave2d_set_clut(get_alif_lut(), AIPL_COLOR_ARGB8888);
 
-    // Enable PMU cycle counter for measurements
-    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
-    ARM_PMU_Enable();
-    ARM_PMU_CNTR_Enable(PMU_CNTENSET_CCNTR_ENABLE_Msk);
+    clock_t splash_ts = 0;
+    if (splash) {
+        show_splash();
+        disp_wait_frame_shown();
+        splash_ts = clock();
+    }
+
+#if defined(DUAL_CORE)
+    // The M55-HE core owns the camera, wait until it has set up the frame ring
+    core_link_connect();
+#else
+    // Init camera
+    ret = init_camera();
+    if (ret != ARM_DRIVER_OK) {
+        __BKPT(1);
+    }
+#endif
+
+#if defined(DUAL_CORE_SPLIT)
+    // Wait until the M55-HE core converts its part of the frames
+    split_convert_connect();
+#endif
+
+    // CPU or D/AVE2D for the operations that can run on both
+    pipeline_init();
+
+#if defined(VIEWFINDER_RTOS)
+    // Task per pipeline stage instead of the loop below
+    pipeline_rtos_start(set_error_led);
+#endif
+
+    dvfs_init(DVFS_TARGET_FPS);
+    frame_governor_init(FRAME_GOVERNOR_FPS);
 
     // Capture frames in loop
     printf("\r\n Let's Start Capturing Camera Frame...\r\n");
     clock_t print_ts = clock();
+    uint32_t frames_since_print = 0;
+    bool booting = true;
     while (ret == ARM_DRIVER_OK) {
+        frame_governor_wait_frame_start();
+        energy_model_add_stage(ENERGY_STAGE_IDLE, frame_governor_last_sleep() * (SystemCoreClock / CLOCKS_PER_SEC));
+
         // Blink green LED
         green_port->SetValue(BOARD_LEDRGB1_G_GPIO_PIN, GPIO_PIN_OUTPUT_STATE_TOGGLE);
         // Reset cycle counter
         ARM_PMU_CYCCNT_Reset();
 
-        uint32_t capture_time = ARM_PMU_Get_CCNTR();
-        ret = camera_capture();
+        pipeline_frame_t frame;
+        ret = pipeline_capture(&frame);
+        if (ret == ARM_DRIVER_OK && !pipeline_convert(&frame)) {
+            ret = ARM_DRIVER_ERROR;
+        }
         if (ret == ARM_DRIVER_OK) {
-            capture_time = ARM_PMU_Get_CCNTR() - capture_time;
-
-            // Do Bayer conversion
-            uint32_t bayer_time = ARM_PMU_Get_CCNTR();
-            // The buffer for cam_image can be static or dynamic depending on camera module configuration
-            bool buffer_is_dynamic = false;
-            aipl_image_t cam_image = camera_post_capture_process(&buffer_is_dynamic);
-            bayer_time = ARM_PMU_Get_CCNTR() - bayer_time;
-
-            // Do color correction for the ARX3A0 camera
-            aipl_error_t aipl_ret = AIPL_ERR_OK;
-#if CAM_COLOR_CORRECTION
-            // See camera.c for coefficients
-            uint32_t cc_time = ARM_PMU_Get_CCNTR();
-            aipl_ret = aipl_color_correction_rgb_img(&cam_image, &cam_image, camera_get_color_correction_matrix());
-            if (aipl_ret != AIPL_ERR_OK) {
-                printf("Error: color correction aipl_ret = %s\r\n", aipl_error_str(aipl_ret));
-                __BKPT(0);
-            }
-
-            aipl_ret = aipl_lut_transform_rgb_img(&cam_image, &cam_image, camera_get_gamma_lut());
-            if (aipl_ret != AIPL_ERR_OK) {
-                printf("Error: gamma correction aipl_ret = %s\r\n", aipl_error_str(aipl_ret));
-                __BKPT(0);
-            }
-            cc_time = ARM_PMU_Get_CCNTR() - cc_time;
-#endif
-
-#if !RTE_ISP
-            // Measure the image processing time (crop and resize)
-            uint32_t ip_time = ARM_PMU_Get_CCNTR();
-
-            // Crop image to a square using the smaller of the camera dimensions
-            const uint32_t crop_dim = cam_image.width > cam_image.height ? cam_image.height : cam_image.width;
-            const uint32_t crop_border = (cam_image.width - crop_dim) / 2;
-            const uint32_t crop_header = (cam_image.height - crop_dim) / 2;
-
-            // Crop can be done in place, save memory by using the cam_image buffer as source and target
-            aipl_image_t crop_image = cam_image;
-            crop_image.pitch = crop_dim;
-            crop_image.width = crop_dim;
-            crop_image.height = crop_dim;
-
-            aipl_ret = aipl_crop_img(&cam_image, &crop_image, crop_border, crop_header, cam_image.width - crop_border,
-                                     cam_image.height - crop_header);
-            if (aipl_ret != AIPL_ERR_OK) {
-                printf("Error: crop aipl_ret = %s\r\n", aipl_error_str(aipl_ret));
-                __BKPT(0);
-            }
-
-            // Resize the cropped image so that it fits to full display width
-            aipl_image_t res_image;
-            aipl_ret = aipl_image_create(&res_image, MY_DISP_HOR_RES, MY_DISP_HOR_RES, MY_DISP_HOR_RES, crop_image.format);
-            if (aipl_ret != AIPL_ERR_OK) {
-                printf("Error: Failed allocating resize temp image\r\n");
-                __BKPT(0);
-            }
-
-            aipl_ret = aipl_resize_img(&crop_image, &res_image,
-                                       true);  // interpolate
-
-            if (buffer_is_dynamic) {
-                aipl_image_destroy(&cam_image);
-            }
-
-            if (aipl_ret != AIPL_ERR_OK) {
-                printf("Error: resize aipl_ret = %s\r\n", aipl_error_str(aipl_ret));
-                __BKPT(0);
+            pipeline_process(&frame);
+            pipeline_render(&frame);
+            pipeline_account_energy(&frame);
+            energy_model_frame_done();
+
+            // Cycle counter was reset at the start of the frame, waiting for the camera does not count as load
+            dvfs_frame_done(ARM_PMU_Get_CCNTR() - frame.capture_cycles);
+
+            if (booting) {
+                // Boot time up to the scan-out of the first frame, clock() counts from the start of main()
+                disp_wait_frame_shown();
+                if (splash) {
+                    printf("Boot: splash shown after %ums\r\n", (unsigned)(splash_ts * 1000 / CLOCKS_PER_SEC));
+                }
+                printf("Boot: first camera frame shown after %ums\r\n", (unsigned)(clock() * 1000 / CLOCKS_PER_SEC));
+                booting = false;
             }
 
-            // Draw the resized image to display
-            aipl_image_t *draw_image = &res_image;
-            ip_time = ARM_PMU_Get_CCNTR() - ip_time;
-#else
-            // Draw ISP processed image to display
-            aipl_image_t *draw_image = &cam_image;
-#endif
-            // Rotate image 180 on AppKit (Camera connected to the connector on the other side than the display)
-#ifdef BOARD_IS_ALIF_APPKIT_B1_VARIANT
-            aipl_image_t rot_image;
-            aipl_ret = aipl_image_create(&rot_image, res_image.width, res_image.width, res_image.height, res_image.format);
-            if (aipl_ret != AIPL_ERR_OK) {
-                printf("Error: Failed allocating rotate temp image\r\n");
-                __BKPT(0);
+#if defined(STANDBY_VIEWFINDER)
+            if (standby_frame_done()) {
+                camera_uninit();
+                display_uninit();
+                standby_enter();
             }
-
-            aipl_ret = aipl_rotate_img(&res_image, &rot_image, AIPL_ROTATE_180);
-            if (aipl_ret != AIPL_ERR_OK) {
-                printf("Error: rotate aipl_ret = %s\r\n", aipl_error_str(aipl_ret));
-                __BKPT(0);
-            }
-            aipl_image_destroy(&res_image);
-            draw_image = &rot_image;
 #endif
 
-            uint32_t render_time = ARM_PMU_Get_CCNTR();
-            aipl_dave2d_prepare();
-            aipl_image_draw(0, 0, draw_image);
-            aipl_image_draw_clut(100, 600, get_alif_logo());
-            aipl_dave2d_render();
-            aipl_image_destroy(draw_image);
-            render_time = ARM_PMU_Get_CCNTR() - render_time;
-
+            frames_since_print++;
             if (clock() - print_ts >= PRINT_INTERVAL_CLOCKS) {
+                float interval_s = (float)(clock() - print_ts) / CLOCKS_PER_SEC;
                 print_ts = clock();
-                printf("Frame capture took %.3fms\r\n", capture_time * 1000.0f / SystemCoreClock);
-
-#if !CAM_USE_RGB565
-                float bayer_time_s = (float)bayer_time / SystemCoreClock;
-                printf("Bayer conversion %.3fms (throughput=%.2fMpix/s)\r\n", bayer_time_s * 1000.0f,
-                                                                            CAM_MPIX / bayer_time_s);
-#endif
-
-#if CAM_COLOR_CORRECTION
-                float cc_time_s = (float)cc_time / SystemCoreClock;
-                printf("Color correction %.3fms (throughput=%.2fMpix/s)\r\n", cc_time_s * 1000.0f,
-                                                                              CAM_MPIX / cc_time_s);
-#endif
-
-#if !RTE_ISP
-                float ip_time_s = (float)ip_time / SystemCoreClock;
-                printf("Image processing %.3fms (throughput=%.2fMpix/s)\r\n", ip_time_s * 1000.0f,
-                                                                              CAM_MPIX / ip_time_s);
-#endif
-                float render_time_s = (float)render_time / SystemCoreClock;
-                printf("Rendering to display %.3fms (throughput=%.2fMpix/s)\r\n", render_time_s * 1000.0f,
-                                                                                  CAM_MPIX / render_time_s);
+                printf("Display rate %.1f FPS at %u MHz\r\n", frames_since_print / interval_s,
+                       (unsigned)(SystemCoreClock / 1000000));
+                frames_since_print = 0;
+                frame_governor_print_stats();
+                energy_model_print();
+                pipeline_print_stats(&frame);
             }
         } else {
             printf("\r\n Error: CAMERA Capture Frame failed.\r\n");
         }
     }
 
+    energy_model_print_summary();
+
     // Set RED LED in error case
-    red_port->SetValue(BOARD_LEDRGB1_R_GPIO_PIN, GPIO_PIN_OUTPUT_STATE_HIGH);
+    set_error_led();
 
     while (1) {
         __WFI();
@@ -0,0 +1,303 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#include "autotune.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#include "aipl_image.h"
+#include "aipl_resize.h"
+#include "aipl_rotate.h"
+#include "camera.h"
+#include "disp.h"
+#include "image.h"
+#include "layout.h"
+#include "work_partition.h"
+
+// Last 4 KB of the application MRAM, kept out of the image by the MRAM linker scripts
+#define AUTOTUNE_RECORD_AREA (0x1000)
+#ifndef AUTOTUNE_RECORD_ADDR
+#include "app_mem_regions.h"
+#if defined(CORE_M55_HE)
+#define AUTOTUNE_RECORD_ADDR (APP_MRAM_HE_BASE + APP_MRAM_HE_SIZE - AUTOTUNE_RECORD_AREA)
+#else
+#define AUTOTUNE_RECORD_ADDR (APP_MRAM_HP_BASE + APP_MRAM_HP_SIZE - AUTOTUNE_RECORD_AREA)
+#endif
+#endif
+
+#define AUTOTUNE_MAGIC (0x454E5554)  // "TUNE"
+
+// Each variant is run once to warm up caches and then timed AUTOTUNE_ITERATIONS times, the fastest run counts
+#define AUTOTUNE_ITERATIONS (3)
+
+// MRAM is written in 128-bit units
+typedef struct __attribute__((aligned(16))) {
+    uint32_t magic;
+    uint32_t key;    // Build and configuration the costs were measured for
+    work_cost_t cost[WORK_OP_COUNT];
+    uint32_t check;  // Hash of the fields above
+} autotune_record_t;
+
+typedef enum {
+    COST_TABLE,     // Not measured, work_partition.c table
+    COST_MEASURED,  // Measured at this boot
+    COST_STORED,    // Measured at an earlier boot, loaded from MRAM
+} cost_source_t;
+
+static const char *const source_names[] = {"table", "measured", "stored"};
+static const char *const op_names[WORK_OP_COUNT] = {"scale", "rotate"};
+
+static work_cost_t costs[WORK_OP_COUNT];
+static cost_source_t sources[WORK_OP_COUNT];
+static uint32_t tune_cycles;
+
+extern uint32_t SystemCoreClock;
+
+static uint32_t hash(uint32_t h, const void *data, uint32_t size) {
+    // FNV-1a
+    const uint8_t *bytes = data;
+    for (uint32_t i = 0; i < size; i++) {
+        h = (h ^ bytes[i]) * 16777619U;
+    }
+    return h;
+}
+
+// Defined by the linker scripts: the build ID note of the linker (--build-id) and the linker variant, 1 MRAM and 2 TCM.
+// Undefined without them, as in the host build, the key then only has the configuration
+extern const uint8_t __build_id_start[] __attribute__((weak));
+extern const uint8_t __build_id_end[] __attribute__((weak));
+extern const uint8_t __linker_variant[] __attribute__((weak));
+
+// A new build, linker variant, core or resolution has to be measured again
+static uint32_t config_key(void) {
+    const uint32_t config[] = {CAM_FRAME_WIDTH, CAM_FRAME_HEIGHT, MY_DISP_HOR_RES, MY_DISP_VER_RES,
+#if defined(CORE_M55_HE)
+                               1,
+#else
+                               0,
+#endif
+                               (uint32_t)(uintptr_t)__linker_variant,
+    };
+    const uint32_t build_id_size = __build_id_start ? (uint32_t)(__build_id_end - __build_id_start) : 0;
+    return hash(hash(2166136261U, __build_id_start, build_id_size), config, sizeof(config));
+}
+
+static uint32_t record_check(const autotune_record_t *record) {
+    return hash(2166136261U, record, offsetof(autotune_record_t, check));
+}
+
+#if AUTOTUNE_PERSIST
+static bool load_record(void) {
+    const autotune_record_t *record = (const autotune_record_t *)AUTOTUNE_RECORD_ADDR;
+    if (record->magic != AUTOTUNE_MAGIC || record->key != config_key() || record->check != record_check(record)) {
+        return false;
+    }
+    for (int op = 0; op < WORK_OP_COUNT; op++) {
+        // Operations stored without cost keep the table cost
+        if (record->cost[op].cpu_cycles_per_px > 0.0f) {
+            costs[op] = record->cost[op];
+            sources[op] = COST_STORED;
+        }
+    }
+    return true;
+}
+
+static void store_record(void) {
+    autotune_record_t record;
+    memset(&record, 0, sizeof(record));
+    record.magic = AUTOTUNE_MAGIC;
+    record.key = config_key();
+    memcpy(record.cost, costs, sizeof(record.cost));
+    record.check = record_check(&record);
+
+    // Aligned 128-bit stores as the MRAM driver does, then drop the cached copy of the old record
+    volatile uint64_t *dst = (volatile uint64_t *)AUTOTUNE_RECORD_ADDR;
+    const uint64_t *src = (const uint64_t *)&record;
+    for (uint32_t i = 0; i < sizeof(record) / sizeof(uint64_t); i += 2) {
+        dst[i] = src[i];
+        dst[i + 1] = src[i + 1];
+        __DSB();
+    }
+    SCB_CleanInvalidateDCache_by_Addr((void *)AUTOTUNE_RECORD_ADDR, sizeof(record));
+}
+#endif
+
+// GPU time of the draws since aipl_dave2d_prepare() in core cycles, into the framebuffer that is not shown
+static uint32_t gpu_draw_cycles(const aipl_image_t *image, uint32_t width, uint32_t height, bool rotate_180) {
+    uint32_t best = UINT32_MAX;
+    for (int i = 0; i <= AUTOTUNE_ITERATIONS; i++) {
+        uint32_t cycles = ARM_PMU_Get_CCNTR();
+        aipl_dave2d_prepare();
+        aipl_image_draw_scaled(0, 0, width, height, 0, 0, image, rotate_180);
+        aipl_dave2d_finish();
+        cycles = ARM_PMU_Get_CCNTR() - cycles;
+        if (i > 0 && cycles < best) {
+            best = cycles;
+        }
+    }
+    return best;
+}
+
+// Extra GPU time of a draw over the 1:1 draw of the same output size
+static float gpu_ns_per_px(uint32_t cycles, uint32_t plain_cycles, uint32_t pixels) {
+    float extra = cycles > plain_cycles ? (float)(cycles - plain_cycles) : 0.0f;
+    return extra * 1e9f / SystemCoreClock / pixels;
+}
+
+static void measure_scale(aipl_image_t *frame, aipl_image_t *shown) {
+    const layout_t *layout = layout_get();
+    const uint32_t pixels = shown->width * shown->height;
+
+    // The crop is a view of the frame on both engines, the content of the frame does not matter
+    aipl_image_t view;
+    aipl_image_view(&view, frame, layout->crop_x, layout->crop_y, layout->crop_width, layout->crop_height);
+
+    // CPU: resize of the view as in the pipeline
+    uint32_t best = UINT32_MAX;
+    for (int i = 0; i <= AUTOTUNE_ITERATIONS; i++) {
+        uint32_t cycles = ARM_PMU_Get_CCNTR();
+        aipl_error_t ret = aipl_resize_img(&view, shown, true);
+        cycles = ARM_PMU_Get_CCNTR() - cycles;
+        if (ret != AIPL_ERR_OK) {
+            printf("Autotune: CPU scale failed (%s)\r\n", aipl_error_str(ret));
+            return;
+        }
+        if (i > 0 && cycles < best) {
+            best = cycles;
+        }
+    }
+
+    // GPU: D/AVE2D scales while drawing
+    uint32_t plain = gpu_draw_cycles(shown, shown->width, shown->height, false);
+    uint32_t scaled = gpu_draw_cycles(&view, shown->width, shown->height, false);
+
+    costs[WORK_OP_SCALE].cpu_cycles_per_px = (float)best / pixels;
+    costs[WORK_OP_SCALE].gpu_ns_per_px = gpu_ns_per_px(scaled, plain, pixels);
+    sources[WORK_OP_SCALE] = COST_MEASURED;
+}
+
+static void measure_rotate(aipl_image_t *shown, aipl_image_t *rotated) {
+    const uint32_t pixels = shown->width * shown->height;
+
+    uint32_t best = UINT32_MAX;
+    for (int i = 0; i <= AUTOTUNE_ITERATIONS; i++) {
+        uint32_t cycles = ARM_PMU_Get_CCNTR();
+        aipl_error_t ret = aipl_rotate_img(shown, rotated, AIPL_ROTATE_180);
+        cycles = ARM_PMU_Get_CCNTR() - cycles;
+        if (ret != AIPL_ERR_OK) {
+            printf("Autotune: CPU rotate failed (%s)\r\n", aipl_error_str(ret));
+            return;
+        }
+        if (i > 0 && cycles < best) {
+            best = cycles;
+        }
+    }
+
+    uint32_t plain = gpu_draw_cycles(shown, shown->width, shown->height, false);
+    uint32_t turned = gpu_draw_cycles(shown, shown->width, shown->height, true);
+
+    costs[WORK_OP_ROTATE].cpu_cycles_per_px = (float)best / pixels;
+    costs[WORK_OP_ROTATE].gpu_ns_per_px = gpu_ns_per_px(turned, plain, pixels);
+    sources[WORK_OP_ROTATE] = COST_MEASURED;
+}
+
+// Synthetic camera frame and shown image of the layout in the format of the converted frames, measured one after
+// the other to fit the video memory
+static void measure(void) {
+    const aipl_color_format_t format = CAM_USE_RGB565 ? AIPL_COLOR_RGB565 : DISP_COLOR_FORMAT;
+    const uint32_t px_size = aipl_color_format_depth(format) / 8;
+    const layout_t *layout = layout_get();
+
+    aipl_image_t shown;
+    if (aipl_image_create(&shown, layout->width, layout->width, layout->height, format) != AIPL_ERR_OK) {
+        printf("Autotune: not enough video memory, using the cost table\r\n");
+        return;
+    }
+    memset(shown.data, 0x5A, shown.pitch * shown.height * px_size);
+
+    if (work_partition_used(WORK_OP_SCALE)) {
+        aipl_image_t frame;
+        if (aipl_image_create(&frame, CAM_FRAME_WIDTH, CAM_FRAME_WIDTH, CAM_FRAME_HEIGHT, format) == AIPL_ERR_OK) {
+            memset(frame.data, 0xA5, frame.pitch * frame.height * px_size);
+            measure_scale(&frame, &shown);
+            aipl_image_destroy(&frame);
+        }
+    }
+
+    if (work_partition_used(WORK_OP_ROTATE)) {
+        aipl_image_t rotated;
+        if (aipl_image_create(&rotated, shown.pitch, shown.width, shown.height, format) == AIPL_ERR_OK) {
+            measure_rotate(&shown, &rotated);
+            aipl_image_destroy(&rotated);
+        }
+    }
+
+    aipl_image_destroy(&shown);
+}
+
+void autotune_run(bool tune) {
+    memset(sources, 0, sizeof(sources));
+
+#if AUTOTUNE_PERSIST
+    bool stored = load_record();
+#else
+    bool stored = false;
+#endif
+    if (!stored && tune) {
+        uint32_t cycles = ARM_PMU_Get_CCNTR();
+        measure();
+        tune_cycles = ARM_PMU_Get_CCNTR() - cycles;
+    }
+
+    bool measured = false;
+    for (int op = 0; op < WORK_OP_COUNT; op++) {
+        if (sources[op] != COST_TABLE) {
+            work_partition_set_cost(op, &costs[op]);
+            measured |= sources[op] == COST_MEASURED;
+        }
+    }
+
+#if AUTOTUNE_PERSIST
+    // Operations that could not be measured are stored with zero cost
+    if (measured) {
+        store_record();
+    }
+#else
+    (void)measured;
+#endif
+    if (tune) {
+        autotune_print_stats();
+    }
+}
+
+void autotune_print_stats(void) {
+    printf("Autotune");
+    if (tune_cycles) {
+        printf(" (%.1fms at boot)", tune_cycles * 1000.0f / SystemCoreClock);
+    }
+    printf(":");
+    for (int op = 0; op < WORK_OP_COUNT; op++) {
+        if (!work_partition_used(op)) {
+            continue;
+        }
+        if (sources[op] == COST_TABLE) {
+            printf(" %s %s", op_names[op], source_names[COST_TABLE]);
+        } else {
+            printf(" %s CPU %.2f cycles/px D/AVE2D %.2f ns/px %s", op_names[op], costs[op].cpu_cycles_per_px,
+                   costs[op].gpu_ns_per_px, source_names[sources[op]]);
+        }
+    }
+    printf("\r\n");
+}
@@ -0,0 +1,47 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef AUTOTUNE_H_
+#define AUTOTUNE_H_
+
+#include <stdbool.h>
+
+/*
+ * Boot-time autotuner of the CPU/GPU work partition.
+ *
+ * Times the CPU and the D/AVE2D variant of every operation in
+ * work_partition.h on a synthetic camera-size frame, drawing into the
+ * framebuffer that is not shown, and hands the measured costs to the work
+ * partition, which then picks the faster variant. The costs depend on the
+ * core, the code placement (MRAM or TCM linker script) and the resolution, so
+ * they are measured on the board instead of taken from the table.
+ *
+ * With AUTOTUNE_PERSIST the costs are kept in a record in the last 4 KB of
+ * the application MRAM, later boots of the same build load them and skip the
+ * measurement. A new build (the build ID of the linker), linker script, core
+ * or camera resolution tunes again.
+ */
+
+// Tune at boot, 0 keeps the cost table of work_partition.c
+#ifndef AUTOTUNE
+#define AUTOTUNE (1)
+#endif
+
+// Store the measured costs in MRAM for the next boots
+#ifndef AUTOTUNE_PERSIST
+#define AUTOTUNE_PERSIST (1)
+#endif
+
+// Load or, with tune, measure the costs and set them in the work partition, call after work_partition_add()
+void autotune_run(bool tune);
+
+// Print the measured costs and whether they were loaded from MRAM
+void autotune_print_stats(void);
+
+#endif  // AUTOTUNE_H_
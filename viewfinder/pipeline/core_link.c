@@ -0,0 +1,181 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#include "core_link.h"
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+#include "Driver_Common.h"
+
+#if RTE_ISP
+#error "The dual-core build captures with the CPI, the ISP output buffers cannot be shared"
+#endif
+
+#define CACHE_LINE (32)
+
+// Written last by core_link_init(), the HP core waits for it
+#define CORE_LINK_MAGIC (0x4B4E4C43)
+
+typedef struct __attribute__((aligned(CACHE_LINE))) {
+    volatile uint32_t magic;
+    volatile uint32_t head;  // Frames posted, HE core only
+} core_link_he_line_t;
+
+typedef struct __attribute__((aligned(CACHE_LINE))) {
+    volatile uint32_t tail;  // Frames released, HP core only
+} core_link_hp_line_t;
+
+typedef struct __attribute__((aligned(CACHE_LINE))) {
+    uint32_t sequence;
+    uint32_t flags;
+    uint32_t capture_cycles;
+} core_link_desc_t;
+
+typedef struct {
+    core_link_he_line_t he;
+    core_link_hp_line_t hp;
+    core_link_desc_t desc[CORE_LINK_SLOTS];
+    uint8_t slots[CORE_LINK_SLOTS][CORE_LINK_SLOT_SIZE] __attribute__((aligned(CACHE_LINE)));
+} core_link_shared_t;
+
+// Shared SRAM, at the same address in the HE and HP images
+static core_link_shared_t core_link __attribute__((section(".noinit.core_link")));
+
+// Write the line back for the other core
+static void publish(volatile void *addr, int32_t size) {
+    SCB_CleanDCache_by_Addr(addr, size);
+}
+
+// Drop the cached copy to see the writes of the other core
+static void refresh(volatile void *addr, int32_t size) {
+    SCB_InvalidateDCache_by_Addr(addr, size);
+}
+
+void core_link_init(void) {
+    core_link_doorbell_init();
+
+    // Invalidate the ring of an earlier run before resetting it
+    core_link.he.magic = 0;
+    publish(&core_link.he, sizeof(core_link.he));
+
+    core_link.he.head = 0;
+    core_link.hp.tail = 0;
+    publish(&core_link.hp, sizeof(core_link.hp));
+
+    core_link.he.magic = CORE_LINK_MAGIC;
+    publish(&core_link.he, sizeof(core_link.he));
+    core_link_doorbell_ring();
+}
+
+void *core_link_acquire(void) {
+    uint32_t head = core_link.he.head;
+    for (;;) {
+        refresh(&core_link.hp, sizeof(core_link.hp));
+        if (head - core_link.hp.tail < CORE_LINK_SLOTS) {
+            break;
+        }
+        core_link_doorbell_wait();
+    }
+    return core_link.slots[head % CORE_LINK_SLOTS];
+}
+
+void core_link_post(uint32_t sequence, uint32_t flags, uint32_t capture_cycles) {
+    uint32_t head = core_link.he.head;
+    core_link_desc_t *desc = &core_link.desc[head % CORE_LINK_SLOTS];
+    desc->sequence = sequence;
+    desc->flags = flags;
+    desc->capture_cycles = capture_cycles;
+    // The slot was written by the camera DMA, only the descriptor is in the cache
+    publish(desc, sizeof(*desc));
+
+    // Publish the descriptor before the new head
+    __DMB();
+    core_link.he.head = head + 1;
+    publish(&core_link.he, sizeof(core_link.he));
+    core_link_doorbell_ring();
+}
+
+int core_link_capture_loop(void) {
+    core_link_init();
+
+    uint32_t sequence = 0;
+    int ret;
+    for (;;) {
+        camera_set_frame_buffer(core_link_acquire());
+
+        uint32_t cycles = ARM_PMU_Get_CCNTR();
+        ret = camera_capture();
+        if (ret != ARM_DRIVER_OK) {
+            break;
+        }
+        core_link_post(sequence++, 0, ARM_PMU_Get_CCNTR() - cycles);
+    }
+
+    // The end of the stream takes a slot as well, the HP core stops at it without releasing it
+    core_link_acquire();
+    core_link_post(sequence, CORE_LINK_END, 0);
+    return ret;
+}
+
+void core_link_connect(void) {
+    core_link_doorbell_init();
+
+    for (;;) {
+        refresh(&core_link.he, sizeof(core_link.he));
+        if (core_link.he.magic == CORE_LINK_MAGIC) {
+            break;
+        }
+        core_link_doorbell_wait();
+    }
+}
+
+bool core_link_receive(core_link_frame_t *frame) {
+    uint32_t tail = core_link.hp.tail;
+    uint32_t head;
+    for (;;) {
+        refresh(&core_link.he, sizeof(core_link.he));
+        head = core_link.he.head;
+        if (head != tail) {
+            break;
+        }
+        core_link_doorbell_wait();
+    }
+    // Read the descriptor only after seeing the head that published it
+    __DMB();
+
+    // Latest frame wins, release the older frames unprocessed so that the HE core can capture into their slots
+    frame->skipped = head - tail - 1;
+    if (frame->skipped) {
+        tail = head - 1;
+        core_link.hp.tail = tail;
+        publish(&core_link.hp, sizeof(core_link.hp));
+        core_link_doorbell_ring();
+    }
+
+    uint32_t slot = tail % CORE_LINK_SLOTS;
+    core_link_desc_t *desc = &core_link.desc[slot];
+    refresh(desc, sizeof(*desc));
+    frame->sequence = desc->sequence;
+    frame->flags = desc->flags;
+    frame->capture_cycles = desc->capture_cycles;
+    frame->slot = slot;
+    frame->data = core_link.slots[slot];
+    if (frame->flags & CORE_LINK_END) {
+        return false;
+    }
+
+    refresh(frame->data, CORE_LINK_SLOT_SIZE);
+    return true;
+}
+
+void core_link_release(void) {
+    core_link.hp.tail = core_link.hp.tail + 1;
+    publish(&core_link.hp, sizeof(core_link.hp));
+    core_link_doorbell_ring();
+}
@@ -0,0 +1,88 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef CORE_LINK_H_
+#define CORE_LINK_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "camera.h"
+
+/*
+ * Cross-core frame ring of the dual-core build (DUAL_CORE).
+ *
+ * The M55-HE image captures camera frames into the slots of a ring in shared
+ * SRAM and posts a descriptor per frame, the M55-HP image receives the frames,
+ * converts them and releases the slot again. Descriptor i always describes
+ * slot i. The HE core writes only the head and the descriptors, the HP core
+ * writes only the tail, each on its own cache line, so the two cores never
+ * write the same cache line. Both sides ring a doorbell after publishing, the
+ * other side sleeps until its doorbell rings.
+ *
+ * The HP core takes the newest posted frame, the slots of older frames it has
+ * not started go back to the HE core unprocessed, so a slow HP core shows the
+ * latest frame instead of the oldest one.
+ *
+ * The ring is placed at the start of SRAM1, the same address in both images,
+ * by the .noinit.core_link section of the linker scripts.
+ */
+
+// Camera frame in the camera output format (Bayer or RGB565)
+#define CORE_LINK_SLOT_SIZE (CAM_FRAME_SIZE * (CAM_USE_RGB565 ? 2 : 1))
+
+// Number of frame slots, two slots let the HE core capture while the HP core converts
+#ifndef CORE_LINK_SLOTS
+#define CORE_LINK_SLOTS (CORE_LINK_SLOT_SIZE <= 0x100000 ? 2 : 1)
+#endif
+
+// Descriptor flags
+#define CORE_LINK_END (1U << 0)  // No more frames, the camera of the HE core failed or ran out
+
+typedef struct {
+    uint32_t sequence;        // Frame number assigned by the HE core
+    uint32_t flags;           // CORE_LINK_* flags
+    uint32_t capture_cycles;  // HE cycles waiting for the camera
+    uint32_t slot;            // Index of the slot holding the frame
+    uint32_t skipped;         // Older frames released unprocessed by this receive
+    void *data;               // Slot buffer
+} core_link_frame_t;
+
+// Doorbell to the other core, MHU on target (core_link_mhu.c), simulated on the host
+void core_link_doorbell_init(void);
+void core_link_doorbell_ring(void);
+// Sleep until the other core rang the doorbell since the last wait
+void core_link_doorbell_wait(void);
+
+/* HE (capture) side */
+
+// Reset the ring and announce it to the HP core
+void core_link_init(void);
+
+// Wait for a free slot, returns its buffer
+void *core_link_acquire(void);
+
+// Publish the frame in the acquired slot to the HP core
+void core_link_post(uint32_t sequence, uint32_t flags, uint32_t capture_cycles);
+
+// Capture camera frames into the ring until the camera fails, returns the camera error
+int core_link_capture_loop(void);
+
+/* HP (processing) side */
+
+// Wait until the HE core has set up the ring
+void core_link_connect(void);
+
+// Wait for a frame and take the newest one, returns false at the end of the stream
+bool core_link_receive(core_link_frame_t *frame);
+
+// Give the slot of the received frame back to the HE core
+void core_link_release(void);
+
+#endif  // CORE_LINK_H_
@@ -0,0 +1,100 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/*
+ * Doorbell of the cross-core frame ring on the MHU between the M55-HE and
+ * M55-HP cores, through the MHU driver of the device pack.
+ *
+ * Each core sends a message on channel 0 of its sender frame and is woken by
+ * the message callback of its receiver frame. The message itself carries no
+ * data, the ring is in shared SRAM (core_link.c). The frames and interrupts
+ * of the M55-HE <-> M55-HP MHU are set per core with the CORE_LINK_MHU_*
+ * defines of viewfinder.cproject.yml.
+ */
+#include "core_link.h"
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+#include "mhu.h"
+
+#ifndef CORE_LINK_MHU_IRQ_PRIORITY
+#define CORE_LINK_MHU_IRQ_PRIORITY (32)
+#endif
+
+// The only MHU of the driver instance lists below
+#define DOORBELL_MHU     (0)
+#define DOORBELL_CHANNEL (0)
+
+static uint32_t sender_base_address_list[] = {CORE_LINK_MHU_TX_BASE};
+static uint32_t receiver_base_address_list[] = {CORE_LINK_MHU_RX_BASE};
+
+static mhu_driver_in_t mhu_driver_in;
+static mhu_driver_out_t mhu_driver_out;
+
+static volatile bool doorbell_pending;
+
+void CORE_LINK_MHU_TX_IRQHandler(void) {
+    mhu_driver_out.sender_irq_handler(DOORBELL_MHU);
+}
+
+void CORE_LINK_MHU_RX_IRQHandler(void) {
+    mhu_driver_out.receiver_irq_handler(DOORBELL_MHU);
+}
+
+static void doorbell_acked(uint32_t sender_id, uint32_t channel_number) {
+    (void)sender_id;
+    (void)channel_number;
+}
+
+static void doorbell_received(uint32_t receiver_id, uint32_t channel_number, uint32_t data) {
+    (void)receiver_id;
+    (void)channel_number;
+    (void)data;
+    doorbell_pending = true;
+}
+
+static void enable_irq(IRQn_Type irq) {
+    NVIC_DisableIRQ(irq);
+    NVIC_ClearPendingIRQ(irq);
+    NVIC_SetPriority(irq, CORE_LINK_MHU_IRQ_PRIORITY);
+    NVIC_EnableIRQ(irq);
+}
+
+void core_link_doorbell_init(void) {
+    mhu_driver_in.sender_base_address_list = sender_base_address_list;
+    mhu_driver_in.receiver_base_address_list = receiver_base_address_list;
+    mhu_driver_in.mhu_count = 1;
+    mhu_driver_in.send_msg_acked_callback = doorbell_acked;
+    mhu_driver_in.rx_msg_callback = doorbell_received;
+    mhu_driver_in.debug_print = NULL;
+    MHU_driver_initialize(&mhu_driver_in, &mhu_driver_out);
+
+    enable_irq(CORE_LINK_MHU_TX_IRQn);
+    enable_irq(CORE_LINK_MHU_RX_IRQn);
+}
+
+void core_link_doorbell_ring(void) {
+    // The ring indices are written back before the other core is woken up
+    __DSB();
+    // A message the other core has not taken yet wakes it up as well, it sees the new indices then
+    mhu_driver_out.send_message(DOORBELL_MHU, DOORBELL_CHANNEL, 1);
+}
+
+void core_link_doorbell_wait(void) {
+    // Check and sleep with interrupts masked, a doorbell in between still ends the WFI
+    __disable_irq();
+    while (!doorbell_pending) {
+        __WFI();
+        __enable_irq();
+        __disable_irq();
+    }
+    doorbell_pending = false;
+    __enable_irq();
+}
@@ -0,0 +1,143 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#include "layout.h"
+
+#include <stdio.h>
+
+#include "disp.h"
+
+typedef struct {
+    uint32_t x;
+    uint32_t y;
+    uint32_t width;
+    uint32_t height;
+} layout_rect_t;
+
+static const char *const mode_names[] = {"fill", "fit"};
+
+static layout_t layout;
+static layout_mode_t layout_mode;
+static bool layout_scaled;
+
+static uint32_t min_u32(uint32_t a, uint32_t b) {
+    return a < b ? a : b;
+}
+
+// Offset that centers size in space, 0 if it does not fit
+static uint32_t center(uint32_t space, uint32_t size) {
+    return size < space ? (space - size) / 2 : 0;
+}
+
+// Overlay band along the bottom or the right edge of the panel, whichever leaves the larger camera area, the camera
+// gets the rest of the panel. The band is the overlay plus half its size as margin. Without room for the band, or when
+// it would take more than half the panel, the camera gets the whole panel and the band is empty
+static void split_panel(uint32_t ow, uint32_t oh, layout_rect_t *area, layout_rect_t *band) {
+    const uint32_t band_h = oh + oh / 2;
+    const uint32_t band_w = ow + ow / 2;
+    const bool bottom = ow <= MY_DISP_HOR_RES && band_h * 2 <= MY_DISP_VER_RES;
+    const bool right = oh <= MY_DISP_VER_RES && band_w * 2 <= MY_DISP_HOR_RES;
+
+    *area = (layout_rect_t){0, 0, MY_DISP_HOR_RES, MY_DISP_VER_RES};
+    *band = (layout_rect_t){0, 0, 0, 0};
+    if (bottom && (!right || MY_DISP_HOR_RES * (MY_DISP_VER_RES - band_h) >=
+                                 (MY_DISP_HOR_RES - band_w) * MY_DISP_VER_RES)) {
+        area->height = MY_DISP_VER_RES - band_h;
+        *band = (layout_rect_t){0, area->height, MY_DISP_HOR_RES, band_h};
+    } else if (right) {
+        area->width = MY_DISP_HOR_RES - band_w;
+        *band = (layout_rect_t){area->width, 0, band_w, MY_DISP_VER_RES};
+    }
+}
+
+// Compare the aspect ratios with products, the frame is wider than the area if fw / fh > aw / ah
+static bool wider(uint32_t fw, uint32_t fh, const layout_rect_t *area) {
+    return (uint64_t)fw * area->height > (uint64_t)fh * area->width;
+}
+
+static void place_frame(uint32_t fw, uint32_t fh, bool scale, const layout_rect_t *area) {
+    uint32_t crop_w = fw;
+    uint32_t crop_h = fh;
+    uint32_t w;
+    uint32_t h;
+
+    if (!scale) {
+        crop_w = min_u32(fw, area->width);
+        crop_h = min_u32(fh, area->height);
+        w = crop_w;
+        h = crop_h;
+    } else if (layout_mode == LAYOUT_FILL) {
+        // The frame side that overhangs the aspect of the area is cropped
+        if (wider(fw, fh, area)) {
+            crop_w = (uint32_t)((uint64_t)fh * area->width / area->height);
+        } else {
+            crop_h = (uint32_t)((uint64_t)fw * area->height / area->width);
+        }
+        w = area->width;
+        h = area->height;
+    } else {
+        // Bars above and below a wider frame, left and right of a narrower one
+        if (wider(fw, fh, area)) {
+            w = area->width;
+            h = (uint32_t)((uint64_t)fh * area->width / fw);
+        } else {
+            w = (uint32_t)((uint64_t)fw * area->height / fh);
+            h = area->height;
+        }
+    }
+
+    layout.crop_x = center(fw, crop_w);
+    layout.crop_y = center(fh, crop_h);
+    layout.crop_width = crop_w;
+    layout.crop_height = crop_h;
+    layout.x = area->x + center(area->width, w);
+    layout.y = area->y + center(area->height, h);
+    layout.width = w;
+    layout.height = h;
+    layout.scale_x = (uint32_t)(((uint64_t)crop_w << 16) / w);
+    layout.scale_y = (uint32_t)(((uint64_t)crop_h << 16) / h);
+    layout_scaled = crop_w != w || crop_h != h;
+}
+
+static void place_overlay(uint32_t ow, uint32_t oh, const layout_rect_t *area, const layout_rect_t *band) {
+    if (band->width && band->height) {
+        layout.overlay_x = band->x + center(band->width, ow);
+        layout.overlay_y = band->y + center(band->height, oh);
+        return;
+    }
+    // No room next to the camera, at the bottom of the camera area half its height above the edge
+    layout.overlay_x = area->x + center(area->width, ow);
+    layout.overlay_y = area->y + (area->height > oh + oh / 2 ? area->height - oh - oh / 2 : 0);
+}
+
+void layout_init(uint32_t frame_width, uint32_t frame_height, bool scale, uint32_t overlay_width,
+                 uint32_t overlay_height) {
+    layout_rect_t area;
+    layout_rect_t band;
+    layout_mode = LAYOUT_MODE;
+    split_panel(overlay_width, overlay_height, &area, &band);
+    place_frame(frame_width, frame_height, scale, &area);
+    place_overlay(overlay_width, overlay_height, &area, &band);
+}
+
+const layout_t *layout_get(void) {
+    return &layout;
+}
+
+bool layout_scales(void) {
+    return layout_scaled;
+}
+
+void layout_print(void) {
+    printf("Layout %s: %ux%u crop at %u,%u drawn %ux%u at %u,%u (scale %.3f), overlay at %u,%u\r\n",
+           mode_names[layout_mode], (unsigned)layout.crop_width, (unsigned)layout.crop_height,
+           (unsigned)layout.crop_x, (unsigned)layout.crop_y, (unsigned)layout.width, (unsigned)layout.height,
+           (unsigned)layout.x, (unsigned)layout.y, layout.scale_x / 65536.0f, (unsigned)layout.overlay_x,
+           (unsigned)layout.overlay_y);
+}
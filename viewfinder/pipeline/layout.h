@@ -0,0 +1,73 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef LAYOUT_H_
+#define LAYOUT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Screen layout of the camera image and the overlay, computed once at init
+ * from the camera frame size (camera.h) and the panel size (disp.h).
+ *
+ * The overlay gets a band along the bottom or the right edge of the panel,
+ * the overlay size plus a margin, and the camera gets the rest of the panel.
+ * When the band would take more than half the panel, the camera gets the
+ * whole panel and the overlay sits at the bottom, over the image. In the
+ * camera area the frame is either center cropped to the aspect of the area
+ * and scaled to fill it (LAYOUT_FILL), or scaled whole to fit and letterboxed
+ * (LAYOUT_FIT). Frames that are not scaled (ISP output) are center cropped to
+ * the area and centered in it.
+ * Only the crop is converted further and only the shown pixels are scaled.
+ */
+
+typedef enum {
+    LAYOUT_FILL,  // Center crop to the aspect of the camera area, no bars
+    LAYOUT_FIT,   // Whole frame, bars on two sides
+} layout_mode_t;
+
+// How the frame fills the camera area
+#ifndef LAYOUT_MODE
+#define LAYOUT_MODE (LAYOUT_FILL)
+#endif
+
+typedef struct {
+    // Shown part of the camera frame
+    uint32_t crop_x;
+    uint32_t crop_y;
+    uint32_t crop_width;
+    uint32_t crop_height;
+    // Where it is drawn on the panel
+    uint32_t x;
+    uint32_t y;
+    uint32_t width;
+    uint32_t height;
+    // Frame pixels per panel pixel in 16.16 fixed point, the step of the D/AVE2D texture mapping
+    uint32_t scale_x;
+    uint32_t scale_y;
+    // Top left corner of the overlay
+    uint32_t overlay_x;
+    uint32_t overlay_y;
+} layout_t;
+
+// Lay out a frame_width x frame_height camera frame, scaled or 1:1, and an overlay_width x overlay_height overlay
+void layout_init(uint32_t frame_width, uint32_t frame_height, bool scale, uint32_t overlay_width,
+                 uint32_t overlay_height);
+
+// Layout of layout_init()
+const layout_t *layout_get(void);
+
+// Whether the crop is scaled to a different size on the panel
+bool layout_scales(void);
+
+// Print the layout
+void layout_print(void);
+
+#endif  // LAYOUT_H_
@@ -0,0 +1,609 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#include "pipeline.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+#include "Driver_Common.h"
+#include "board_config.h"
+
+#include "aipl_color_correction.h"
+#include "aipl_lut_transform.h"
+#include "aipl_resize.h"
+#include "aipl_rotate.h"
+#include "alif_logo.h"
+#include "autotune.h"
+#include "camera.h"
+#include "disp.h"
+#include "energy_model.h"
+#include "image.h"
+#include "layout.h"
+#include "work_partition.h"
+
+#if defined(STANDBY_VIEWFINDER)
+#include "standby.h"
+#endif
+#if defined(DUAL_CORE)
+#include "core_link.h"
+#endif
+#if defined(DUAL_CORE_SPLIT)
+#include "split_convert.h"
+#endif
+#if defined(VIEWFINDER_RTOS)
+#include "pipeline_rtos.h"
+// AIPL kernels may run on D/AVE2D, which must not be used by two tasks at a time
+#define GPU_LOCK()   pipeline_rtos_gpu_lock()
+#define GPU_UNLOCK() pipeline_rtos_gpu_unlock()
+#else
+#define GPU_LOCK()
+#define GPU_UNLOCK()
+#endif
+
+#if DISP_BEAM_RACING && defined(VIEWFINDER_RTOS)
+#error "Beam racing waits for the CDC200 line interrupts in __WFI(), not in the render task"
+#endif
+
+// Direct capture needs the CPU pipeline to stay out of the frame: no second core, no frames in flight, no rotation,
+// and a framebuffer that is not scanned out while the CPI writes it
+#if PIPELINE_DIRECT_CAPTURE && CAM_USE_RGB565 && !RTE_ISP && !defined(DUAL_CORE) && !defined(VIEWFINDER_RTOS) && \
+    !defined(BOARD_IS_ALIF_APPKIT_B1_VARIANT) && !DISP_BEAM_RACING
+#define DIRECT_CAPTURE_SUPPORTED (1)
+#else
+#define DIRECT_CAPTURE_SUPPORTED (0)
+#endif
+
+extern uint32_t SystemCoreClock;
+
+// The logo is on the CDC200 overlay layer, it is not drawn into the framebuffers
+static bool logo_on_overlay;
+
+#if !defined(DUAL_CORE)
+static uint32_t frame_sequence;
+#endif
+
+#if DISP_BEAM_RACING
+// Bands drawn and bands the beam reached before they were done since the last statistics
+static uint32_t beam_bands;
+static uint32_t beam_misses;
+// Fewest lines left before the beam came back to a band
+static int32_t beam_min_slack = INT32_MAX;
+#endif
+
+// Expand the CLUT logo once and let the display controller blend it at scan-out
+static void logo_overlay_init(void) {
+#if PIPELINE_LOGO_OVERLAY
+    const aipl_image_t *logo = get_alif_logo();
+    const uint8_t *lut = get_alif_lut();  // ARGB8888, B G R A bytes
+    aipl_image_t overlay;  // Kept for as long as the layer is shown
+    if (aipl_image_create(&overlay, logo->width, logo->width, logo->height, AIPL_COLOR_ARGB4444) !=
+        AIPL_ERR_OK) {
+        printf("Logo overlay: not enough video memory, blending the logo with D/AVE2D\r\n");
+        return;
+    }
+
+    const uint8_t *src = logo->data;
+    uint16_t *dst = overlay.data;
+    for (uint32_t y = 0; y < logo->height; y++) {
+        for (uint32_t x = 0; x < logo->width; x++) {
+            const uint8_t *c = &lut[src[y * logo->pitch + x] * 4];
+            dst[y * overlay.pitch + x] = (uint16_t)((c[3] >> 4) << 12 | (c[2] >> 4) << 8 | (c[1] >> 4) << 4 |
+                                                    c[0] >> 4);
+        }
+    }
+
+    const layout_t *layout = layout_get();
+    if (disp_overlay_show(overlay.data, layout->overlay_x, layout->overlay_y, overlay.width, overlay.height) !=
+        ARM_DRIVER_OK) {
+        printf("Logo overlay: not inside the panel, blending the logo with D/AVE2D\r\n");
+        aipl_image_destroy(&overlay);
+        return;
+    }
+    logo_on_overlay = true;
+#endif
+}
+
+#if DIRECT_CAPTURE_SUPPORTED
+static bool direct_capture;
+
+// The CPI writes whole rows without a pitch, so the layout must show the whole frame 1:1 across the RGB565 panel
+static bool direct_capture_fits(void) {
+    const layout_t *layout = layout_get();
+    if (RTE_CDC200_PIXEL_FORMAT != 2 || layout_scales() || layout->crop_width != CAM_FRAME_WIDTH ||
+        layout->crop_height != CAM_FRAME_HEIGHT || layout->width != MY_DISP_HOR_RES) {
+        printf("Direct capture: %ux%u camera frame is not shown 1:1 across the %ux%u panel, using the pipeline\r\n",
+               (unsigned)CAM_FRAME_WIDTH, (unsigned)CAM_FRAME_HEIGHT, (unsigned)MY_DISP_HOR_RES,
+               (unsigned)MY_DISP_VER_RES);
+        return false;
+    }
+    return true;
+}
+
+// Background and logo of both framebuffers, afterwards only the camera rows change
+static void direct_capture_start(void) {
+    for (int i = 0; i < 2; i++) {
+        aipl_dave2d_prepare();
+        if (!logo_on_overlay) {
+            aipl_image_draw_clut(layout_get()->overlay_x, layout_get()->overlay_y, get_alif_logo());
+        }
+        aipl_dave2d_render();
+    }
+    printf("Direct capture: the CPI writes the %ux%u frames into the framebuffer\r\n", (unsigned)CAM_FRAME_WIDTH,
+           (unsigned)CAM_FRAME_HEIGHT);
+}
+#endif
+
+#if defined(VIEWFINDER_RTOS) && !RTE_ISP
+// Whether the frames in flight with a D/AVE2D scale, each with the camera frame converted, fit in video memory
+static bool scale_frames_fit(const aipl_image_t *camera_frame, bool report) {
+    aipl_image_t images[PIPELINE_RTOS_SCALE_FRAMES];
+    uint32_t created = 0;
+    while (created < PIPELINE_RTOS_SCALE_FRAMES &&
+           aipl_image_create(&images[created], camera_frame->pitch, camera_frame->width, camera_frame->height,
+                             DISP_COLOR_FORMAT) == AIPL_ERR_OK) {
+        created++;
+    }
+    for (uint32_t i = 0; i < created; i++) {
+        aipl_image_destroy(&images[i]);
+    }
+
+    if (created < PIPELINE_RTOS_SCALE_FRAMES && report) {
+        printf("Work partition: %u camera images do not fit in video memory, scaling on the CPU\r\n",
+               (unsigned)PIPELINE_RTOS_SCALE_FRAMES);
+    }
+    return created == PIPELINE_RTOS_SCALE_FRAMES;
+}
+#endif
+
+void pipeline_init(void) {
+#if defined(STANDBY_VIEWFINDER)
+    // A timer wake-up of standby shows a single frame, it is not worth tuning or reporting for
+    const bool report = standby_wake_reason() != STANDBY_WAKE_TIMER;
+#else
+    const bool report = true;
+#endif
+    // Frames of the ISP are already scaled by the ISP
+    const aipl_image_t frame = camera_frame_image();
+    const aipl_image_t *logo = get_alif_logo();
+    layout_init(frame.width, frame.height, !RTE_ISP, logo->width, logo->height);
+    if (report) {
+        layout_print();
+    }
+
+    work_partition_init();
+    logo_overlay_init();
+#if DISP_BEAM_RACING
+    // The one framebuffer is scanned out, drawing it without following the beam would tear every frame
+    if (disp_beam_start(PIPELINE_BEAM_BAND_LINES) != ARM_DRIVER_OK) {
+        printf("Error: Beam racing needs the CDC200 line interrupts\r\n");
+        __BKPT(0);
+    }
+#endif
+#if DIRECT_CAPTURE_SUPPORTED
+    direct_capture = direct_capture_fits();
+    if (direct_capture) {
+        // Nothing is scaled or rotated
+        direct_capture_start();
+        return;
+    }
+#endif
+    const uint32_t shown_pixels = layout_get()->width * layout_get()->height;
+#if !RTE_ISP
+    // A crop of the size it has on the panel is not scaled
+    if (layout_scales()) {
+#if defined(VIEWFINDER_RTOS)
+        // A frame scaled by D/AVE2D keeps the whole camera image until it is rendered, the RTOS pipeline bounds those
+        work_partition_add(WORK_OP_SCALE, shown_pixels,
+                           scale_frames_fit(&frame, report) ? WORK_ENGINES_ALL : WORK_ENGINES_CPU);
+#elif DISP_BEAM_RACING
+        // Scaled band by band while drawing, the CPU would scale the whole frame before the first band
+        work_partition_add(WORK_OP_SCALE, shown_pixels, WORK_ENGINES_GPU);
+#else
+        work_partition_add(WORK_OP_SCALE, shown_pixels, WORK_ENGINES_ALL);
+#endif
+    }
+#endif
+#if defined(BOARD_IS_ALIF_APPKIT_B1_VARIANT) && DISP_BEAM_RACING
+    work_partition_add(WORK_OP_ROTATE, shown_pixels, WORK_ENGINES_GPU);
+#elif defined(BOARD_IS_ALIF_APPKIT_B1_VARIANT)
+    work_partition_add(WORK_OP_ROTATE, shown_pixels, WORK_ENGINES_ALL);
+#else
+    (void)shown_pixels;
+#endif
+#if AUTOTUNE
+    autotune_run(report);
+#endif
+    if (report) {
+        work_partition_print();
+    }
+}
+
+int pipeline_capture(pipeline_frame_t *frame) {
+    memset(frame, 0, sizeof(*frame));
+
+    uint32_t cycles = ARM_PMU_Get_CCNTR();
+#if defined(DUAL_CORE)
+    // The HE core captures, wait for its next frame and convert it in place in the shared slot
+    core_link_frame_t link;
+    if (!core_link_receive(&link)) {
+        return ARM_DRIVER_ERROR;
+    }
+    camera_set_frame_buffer(link.data);
+    frame->capture_cycles = ARM_PMU_Get_CCNTR() - cycles;
+    frame->sequence = link.sequence;
+#else
+#if DIRECT_CAPTURE_SUPPORTED
+    if (direct_capture) {
+        // Into the framebuffer shown next, at the first row of the camera area
+        const uint32_t row_bytes = MY_DISP_HOR_RES * DISP_PIXEL_SIZE;
+        camera_set_frame_buffer((uint8_t *)disp_inactive_buffer() + layout_get()->y * row_bytes);
+    }
+#endif
+    int ret = camera_capture();
+    if (ret != ARM_DRIVER_OK) {
+        return ret;
+    }
+    frame->capture_cycles = ARM_PMU_Get_CCNTR() - cycles;
+    frame->sequence = frame_sequence++;
+#endif
+    return ARM_DRIVER_OK;
+}
+
+bool pipeline_convert(pipeline_frame_t *frame) {
+#if DIRECT_CAPTURE_SUPPORTED
+    if (direct_capture) {
+        // Already RGB565 in the framebuffer, the CPU does not touch it
+        frame->image = camera_frame_image();
+        return true;
+    }
+#endif
+    // Do Bayer conversion
+    uint32_t cycles = ARM_PMU_Get_CCNTR();
+#if defined(DUAL_CORE_SPLIT)
+    // Both cores convert a part of the frame, including the color correction
+    aipl_image_t raw = camera_frame_image();
+    if (aipl_image_create(&frame->image, raw.pitch, raw.width, raw.height, DISP_COLOR_FORMAT) != AIPL_ERR_OK) {
+        printf("Error: Failed allocating camera image\r\n");
+        return false;
+    }
+    frame->image_is_dynamic = true;
+    if (!split_convert(&raw, &frame->image)) {
+        pipeline_release(frame);
+        return false;
+    }
+    // Written back for D/AVE2D like camera_post_capture_process() does
+    SCB_CleanDCache();
+#else
+    // The buffer for the camera image can be static or dynamic depending on camera module configuration
+    // Converted straight to the panel format, D/AVE2D draws it without a conversion
+    frame->image = camera_post_capture_process(&frame->image_is_dynamic, DISP_COLOR_FORMAT);
+#endif
+    frame->convert_cycles = ARM_PMU_Get_CCNTR() - cycles;
+#if defined(DUAL_CORE)
+    // Hand the slot back to the HE core right away, so that it can capture during the processing
+    bool ok = frame->image.data != NULL && pipeline_detach(frame);
+    core_link_release();
+    return ok;
+#else
+    return frame->image.data != NULL;
+#endif
+}
+
+bool pipeline_detach(pipeline_frame_t *frame) {
+    if (frame->image_is_dynamic) {
+        return true;
+    }
+
+    aipl_image_t copy;
+    aipl_error_t aipl_ret = aipl_image_create(&copy, frame->image.pitch, frame->image.width, frame->image.height,
+                                              frame->image.format);
+    if (aipl_ret != AIPL_ERR_OK) {
+        printf("Error: Failed allocating camera image copy\r\n");
+        return false;
+    }
+    memcpy(copy.data, frame->image.data,
+           frame->image.pitch * frame->image.height * aipl_color_format_depth(frame->image.format) / 8);
+
+    frame->image = copy;
+    frame->image_is_dynamic = true;
+    return true;
+}
+
+// Part of the frame image that is shown, a view into the image after the crop
+static aipl_image_t frame_view(const pipeline_frame_t *frame) {
+    aipl_image_t view = frame->image;
+    const pipeline_draw_t *draw = &frame->draw;
+    if (draw->crop_width) {
+        aipl_image_view(&view, &frame->image, draw->crop_x, draw->crop_y, draw->crop_width, draw->crop_height);
+    }
+    return view;
+}
+
+#if CAM_COLOR_CORRECTION && !defined(DUAL_CORE_SPLIT)
+static void color_correct(pipeline_frame_t *frame) {
+    // Only the cropped part, in place through the view. See camera.c for coefficients
+    aipl_image_t view = frame_view(frame);
+    aipl_error_t aipl_ret = aipl_color_correction_rgb_img(&view, &view, camera_get_color_correction_matrix());
+    if (aipl_ret != AIPL_ERR_OK) {
+        printf("Error: color correction aipl_ret = %s\r\n", aipl_error_str(aipl_ret));
+        __BKPT(0);
+    }
+
+    aipl_ret = aipl_lut_transform_rgb_img(&view, &view, camera_get_gamma_lut());
+    if (aipl_ret != AIPL_ERR_OK) {
+        printf("Error: gamma correction aipl_ret = %s\r\n", aipl_error_str(aipl_ret));
+        __BKPT(0);
+    }
+}
+#endif
+
+// Crop of the layout, only recorded, no pixels move
+static void crop_to_layout(pipeline_frame_t *frame) {
+    const layout_t *layout = layout_get();
+    frame->draw.crop_x = layout->crop_x;
+    frame->draw.crop_y = layout->crop_y;
+    frame->draw.crop_width = layout->crop_width;
+    frame->draw.crop_height = layout->crop_height;
+}
+
+#if !RTE_ISP
+static void resize(pipeline_frame_t *frame) {
+    // Resize the cropped view to its size on the panel, the kernel follows the pitch of the frame
+    const layout_t *layout = layout_get();
+    aipl_image_t view = frame_view(frame);
+    aipl_image_t res_image;
+    aipl_error_t aipl_ret = aipl_image_create(&res_image, layout->width, layout->width, layout->height,
+                                              view.format);
+    if (aipl_ret != AIPL_ERR_OK) {
+        printf("Error: Failed allocating resize temp image\r\n");
+        __BKPT(0);
+    }
+
+    GPU_LOCK();
+    aipl_ret = aipl_resize_img(&view, &res_image,
+                               true);  // interpolate
+    GPU_UNLOCK();
+
+    pipeline_release(frame);
+
+    if (aipl_ret != AIPL_ERR_OK) {
+        printf("Error: resize aipl_ret = %s\r\n", aipl_error_str(aipl_ret));
+        __BKPT(0);
+    }
+
+    frame->image = res_image;
+    frame->image_is_dynamic = true;
+    memset(&frame->draw, 0, sizeof(frame->draw));
+}
+
+// Leave the scale to the render stage, the image stays as it is
+static void scale_on_gpu(pipeline_frame_t *frame) {
+    const layout_t *layout = layout_get();
+    frame->draw.width = layout->width;
+    frame->draw.height = layout->height;
+    frame->draw.scale_x = layout->scale_x;
+    frame->draw.scale_y = layout->scale_y;
+}
+#endif
+
+#ifdef BOARD_IS_ALIF_APPKIT_B1_VARIANT
+static void rotate_180(pipeline_frame_t *frame) {
+    // Only the view, a scale left to D/AVE2D then draws the whole rotated image
+    aipl_image_t view = frame_view(frame);
+    aipl_image_t rot_image;
+    aipl_error_t aipl_ret = aipl_image_create(&rot_image, view.width, view.width, view.height, view.format);
+    if (aipl_ret != AIPL_ERR_OK) {
+        printf("Error: Failed allocating rotate temp image\r\n");
+        __BKPT(0);
+    }
+
+    GPU_LOCK();
+    aipl_ret = aipl_rotate_img(&view, &rot_image, AIPL_ROTATE_180);
+    GPU_UNLOCK();
+    if (aipl_ret != AIPL_ERR_OK) {
+        printf("Error: rotate aipl_ret = %s\r\n", aipl_error_str(aipl_ret));
+        __BKPT(0);
+    }
+
+    pipeline_release(frame);
+    frame->image = rot_image;
+    frame->image_is_dynamic = true;
+    frame->draw.crop_width = 0;
+}
+#endif
+
+void pipeline_process(pipeline_frame_t *frame) {
+#if DIRECT_CAPTURE_SUPPORTED
+    if (direct_capture) {
+        return;
+    }
+#endif
+    crop_to_layout(frame);
+
+    // Do color correction for the ARX3A0 camera, part of the conversion in the split build
+#if CAM_COLOR_CORRECTION && !defined(DUAL_CORE_SPLIT)
+    uint32_t cc_time = ARM_PMU_Get_CCNTR();
+    color_correct(frame);
+    frame->cc_cycles = ARM_PMU_Get_CCNTR() - cc_time;
+#endif
+
+    // Measure the image processing time (resize and rotate)
+    uint32_t ip_time = ARM_PMU_Get_CCNTR();
+#if !RTE_ISP
+    // A crop of its size on the panel is drawn 1:1
+    if (work_partition_used(WORK_OP_SCALE)) {
+        if (work_partition_engine(WORK_OP_SCALE) == WORK_ENGINE_GPU) {
+            scale_on_gpu(frame);
+        } else {
+            resize(frame);
+        }
+    }
+#endif  // ISP processed image is only cropped
+
+    // Rotate image 180 on AppKit (Camera connected to the connector on the other side than the display)
+#ifdef BOARD_IS_ALIF_APPKIT_B1_VARIANT
+    if (work_partition_engine(WORK_OP_ROTATE) == WORK_ENGINE_GPU) {
+        frame->draw.rotate_180 = true;
+    } else {
+        rotate_180(frame);
+    }
+#endif
+    frame->process_cycles = ARM_PMU_Get_CCNTR() - ip_time;
+}
+
+// Camera image and, unless the display controller blends it from the overlay layer, the logo
+static void draw_frame(const pipeline_draw_t *draw, const aipl_image_t *view, uint32_t width, uint32_t height) {
+    const layout_t *layout = layout_get();
+    if (draw->width || draw->rotate_180) {
+        // D/AVE2D scales and rotates the view while drawing
+        aipl_image_draw_scaled(layout->x, layout->y, width, height, draw->scale_x, draw->scale_y, view,
+                               draw->rotate_180);
+    } else {
+        aipl_image_draw(layout->x, layout->y, view);
+    }
+    if (!logo_on_overlay) {
+        aipl_image_draw_clut(layout->overlay_x, layout->overlay_y, get_alif_logo());
+    }
+}
+
+#if DISP_BEAM_RACING
+// Into the framebuffer that is scanned out: a band is drawn once the beam has passed it, and has to be done before
+// the beam comes back to its first row in the next scan-out
+static void render_bands(const pipeline_draw_t *draw, const aipl_image_t *view, uint32_t width, uint32_t height) {
+    const layout_t *layout = layout_get();
+    aipl_dave2d_prepare_bands(layout->x, layout->y, width, height);
+    for (uint32_t y = 0; y < MY_DISP_VER_RES; y += PIPELINE_BEAM_BAND_LINES) {
+        uint32_t lines = MY_DISP_VER_RES - y < PIPELINE_BEAM_BAND_LINES ? MY_DISP_VER_RES - y
+                                                                        : PIPELINE_BEAM_BAND_LINES;
+        if (!aipl_dave2d_prepare_band(y, lines)) {
+            continue;
+        }
+        // Recorded while the beam may still scan the band, run after it
+        draw_frame(draw, view, width, height);
+        uint32_t passed = disp_beam_wait(y + lines);
+        aipl_dave2d_finish();
+        // Lines until the beam is back at the band, the position moves at the band interrupts
+        int32_t slack = (int32_t)(passed + DISP_SCAN_LINES - lines - disp_beam_position());
+        beam_bands++;
+        if (slack <= 0) {
+            beam_misses++;
+        }
+        if (slack < beam_min_slack) {
+            beam_min_slack = slack;
+        }
+    }
+    // Shown as it is, the frame is complete in the next scan-out
+    disp_next_frame();
+}
+#endif
+
+void pipeline_render(pipeline_frame_t *frame) {
+    uint32_t render_time = ARM_PMU_Get_CCNTR();
+#if DIRECT_CAPTURE_SUPPORTED
+    if (direct_capture) {
+        // The frame is the framebuffer, only show it
+        disp_next_frame();
+        frame->render_cycles = ARM_PMU_Get_CCNTR() - render_time;
+        return;
+    }
+#endif
+    const pipeline_draw_t *draw = &frame->draw;
+    aipl_image_t view = frame_view(frame);
+    uint32_t width = draw->width ? draw->width : view.width;
+    uint32_t height = draw->height ? draw->height : view.height;
+
+    GPU_LOCK();
+#if DISP_BEAM_RACING
+    render_bands(draw, &view, width, height);
+#else
+    // Only the camera image and the damage of the framebuffer are cleared, the logo is redrawn where it was cleared
+    const layout_t *layout = layout_get();
+    aipl_dave2d_prepare_damage(layout->x, layout->y, width, height);
+    draw_frame(draw, &view, width, height);
+    aipl_dave2d_render();
+#endif
+    GPU_UNLOCK();
+    pipeline_release(frame);
+    frame->render_cycles = ARM_PMU_Get_CCNTR() - render_time;
+}
+
+void pipeline_release(pipeline_frame_t *frame) {
+    if (frame->image_is_dynamic) {
+        aipl_image_destroy(&frame->image);
+        frame->image_is_dynamic = false;
+    }
+}
+
+void pipeline_account_energy(const pipeline_frame_t *frame) {
+    energy_model_add_stage(ENERGY_STAGE_CAPTURE, frame->capture_cycles);
+    energy_model_add_stage(ENERGY_STAGE_CONVERT, frame->convert_cycles);
+#if CAM_COLOR_CORRECTION && !defined(DUAL_CORE_SPLIT)
+    energy_model_add_stage(ENERGY_STAGE_COLOR_CORRECTION, frame->cc_cycles);
+#endif
+#if !RTE_ISP
+    energy_model_add_stage(ENERGY_STAGE_PROCESSING, frame->process_cycles);
+#endif
+    energy_model_add_stage(ENERGY_STAGE_RENDER, frame->render_cycles);
+}
+
+void pipeline_print_stats(const pipeline_frame_t *frame) {
+    printf("Frame capture took %.3fms\r\n", frame->capture_cycles * 1000.0f / SystemCoreClock);
+
+#if DIRECT_CAPTURE_SUPPORTED
+    if (direct_capture) {
+        printf("Direct capture to the framebuffer, flip %.3fms\r\n", frame->render_cycles * 1000.0f / SystemCoreClock);
+        return;
+    }
+#endif
+
+#if !CAM_USE_RGB565
+    float bayer_time_s = (float)frame->convert_cycles / SystemCoreClock;
+    printf("Bayer conversion %.3fms (throughput=%.2fMpix/s)\r\n", bayer_time_s * 1000.0f,
+                                                                CAM_MPIX / bayer_time_s);
+#endif
+
+#if defined(DUAL_CORE_SPLIT)
+    split_convert_print_stats();
+#endif
+
+#if CAM_COLOR_CORRECTION && !defined(DUAL_CORE_SPLIT)
+    float cc_time_s = (float)frame->cc_cycles / SystemCoreClock;
+    printf("Color correction %.3fms (throughput=%.2fMpix/s)\r\n", cc_time_s * 1000.0f,
+                                                                  CAM_MPIX / cc_time_s);
+#endif
+
+#if !RTE_ISP
+    float ip_time_s = (float)frame->process_cycles / SystemCoreClock;
+    printf("Image processing %.3fms (throughput=%.2fMpix/s)\r\n", ip_time_s * 1000.0f,
+                                                                  CAM_MPIX / ip_time_s);
+#endif
+    float render_time_s = (float)frame->render_cycles / SystemCoreClock;
+    printf("Rendering to display %.3fms (throughput=%.2fMpix/s), %u%% of the panel redrawn\r\n",
+           render_time_s * 1000.0f, CAM_MPIX / render_time_s,
+           (unsigned)(aipl_dave2d_drawn_pixels() * 100U / (MY_DISP_HOR_RES * MY_DISP_VER_RES)));
+
+#if DISP_BEAM_RACING
+    if (beam_bands) {
+        // The render time includes the waits for the beam
+        printf("Beam racing: %u of %u bands missed the beam, least slack %d lines\r\n", (unsigned)beam_misses,
+               (unsigned)beam_bands, (int)beam_min_slack);
+        beam_bands = 0;
+        beam_misses = 0;
+        beam_min_slack = INT32_MAX;
+    }
+#endif
+
+#if AUTOTUNE
+    autotune_print_stats();
+    work_partition_print();
+#endif
+}
@@ -0,0 +1,118 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef PIPELINE_H_
+#define PIPELINE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "aipl_image.h"
+
+/*
+ * Stages of the viewfinder pipeline.
+ *
+ * A frame moves through capture (camera frame), convert (to the panel
+ * format), process (color correction, crop, resize, rotate) and render
+ * (D/AVE2D drawing and buffer flip). The super-loop in main() runs the
+ * stages back to back, the RTOS build (pipeline_rtos.c) runs every stage in
+ * its own task. In the dual-core build (core_link.c) the M55-HE core
+ * captures and capture only waits for the next frame from it. In the split
+ * build (split_convert.c) both cores convert a part of every frame.
+ *
+ * With an RGB565 camera whose frame the layout shows whole and 1:1 across
+ * the panel, the CPI writes the frames straight into the camera area of the
+ * framebuffer that is shown next and render only flips it (direct capture).
+ * Other geometries use the stages above.
+ *
+ * With the layer control of the host CDC200 driver the logo is on the
+ * overlay layer and blended by the display controller at scan-out, the
+ * framebuffers only hold the camera image. On the board render blends it.
+ *
+ * With DISP_BEAM_RACING (disp.h) there is one framebuffer and render draws
+ * it in bands of rows right behind the beam, each band before the beam comes
+ * back to it: the frame is shown in the next scan-out without a flip.
+ */
+
+// Capture RGB565 frames into the framebuffer when the layout shows them 1:1 across the panel, 0 uses the stages
+#ifndef PIPELINE_DIRECT_CAPTURE
+#define PIPELINE_DIRECT_CAPTURE (1)
+#endif
+
+// Show the logo on the CDC200 overlay layer, 0 blends it into every frame with D/AVE2D
+#ifndef PIPELINE_LOGO_OVERLAY
+#define PIPELINE_LOGO_OVERLAY (1)
+#endif
+
+// Rows of a render band with DISP_BEAM_RACING, a CDC200 line interrupt at each band
+#ifndef PIPELINE_BEAM_BAND_LINES
+#define PIPELINE_BEAM_BAND_LINES (100)
+#endif
+
+// Shown part of the frame image and how the render stage draws it. The crop is a view into the image
+// (aipl_image_view()), scale and rotation are set by the operations assigned to D/AVE2D (work_partition.h)
+typedef struct {
+    uint32_t crop_x;       // Shown part of the image
+    uint32_t crop_y;
+    uint32_t crop_width;   // 0 shows the whole image
+    uint32_t crop_height;
+    uint32_t width;        // Size on the display, 0 draws 1:1
+    uint32_t height;
+    uint32_t scale_x;      // Texture mapping step of the scale (layout.h), 0 derives it from the sizes
+    uint32_t scale_y;
+    bool rotate_180;
+} pipeline_draw_t;
+
+typedef struct {
+    aipl_image_t image;       // Frame at its current stage
+    pipeline_draw_t draw;     // Scale and rotation left to the render stage
+    bool image_is_dynamic;    // image is allocated from video memory and owned by the frame
+    uint32_t sequence;        // Frame number, counts captured frames
+
+    // Cycles spent in each stage at the core clock of the stage
+    uint32_t capture_cycles;  // Waiting for the camera
+    uint32_t convert_cycles;  // Bayer or YUY2 to the panel format
+    uint32_t cc_cycles;       // Color and gamma correction
+    uint32_t process_cycles;  // Crop, resize, rotate
+    uint32_t render_cycles;   // D/AVE2D drawing
+} pipeline_frame_t;
+
+// Assign the operations of this build to the CPU or D/AVE2D, or set up direct capture, call before the first frame
+void pipeline_init(void);
+
+// Capture the next camera frame into the camera frame buffer, returns ARM_DRIVER_OK
+// In the dual-core build, receive the next frame captured by the M55-HE core instead
+int pipeline_capture(pipeline_frame_t *frame);
+
+// Convert the captured frame to the panel format (DISP_COLOR_FORMAT), the camera frame buffer is free again afterwards
+// unless the image still uses it (RGB565 camera output, see pipeline_detach())
+// In the dual-core build, the frame is always detached and the slot goes back to the M55-HE core
+bool pipeline_convert(pipeline_frame_t *frame);
+
+// Copy a frame that still uses the camera frame buffer to video memory, so that the next capture can start
+bool pipeline_detach(pipeline_frame_t *frame);
+
+// Crop and resize to the layout (layout.h), color correction, rotate if needed
+// The crop and the resize and rotation assigned to D/AVE2D are only recorded in frame->draw
+void pipeline_process(pipeline_frame_t *frame);
+
+// Draw the frame, and the logo unless it is on the overlay layer, to the inactive framebuffer and show it
+// Releases the frame image
+void pipeline_render(pipeline_frame_t *frame);
+
+// Release the frame image without rendering it
+void pipeline_release(pipeline_frame_t *frame);
+
+// Add the stage cycles of the frame to the energy model
+void pipeline_account_energy(const pipeline_frame_t *frame);
+
+// Print the stage timings of the frame
+void pipeline_print_stats(const pipeline_frame_t *frame);
+
+#endif  // PIPELINE_H_
@@ -0,0 +1,278 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#include "pipeline_rtos.h"
+
+#include <stdio.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+#include "Driver_Common.h"
+
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "semphr.h"
+#include "task.h"
+
+#include "camera.h"
+#include "energy_model.h"
+#include "pipeline.h"
+#include "work_partition.h"
+
+// Frames waiting between two stages, each frame in flight holds its images in video memory
+#ifndef PIPELINE_RTOS_QUEUE_DEPTH
+#define PIPELINE_RTOS_QUEUE_DEPTH (1)
+#endif
+
+// Frame statistics waiting for the telemetry task, dropped when it falls behind
+#define TELEMETRY_QUEUE_DEPTH (4)
+
+#define RENDER_PRIORITY    (tskIDLE_PRIORITY + 4)
+#define CAPTURE_PRIORITY   (tskIDLE_PRIORITY + 3)
+#define PROCESS_PRIORITY   (tskIDLE_PRIORITY + 2)
+#define TELEMETRY_PRIORITY (tskIDLE_PRIORITY + 1)
+
+#define CAPTURE_STACK_WORDS   (512)
+#define PROCESS_STACK_WORDS   (1024)
+#define RENDER_STACK_WORDS    (1024)
+#define TELEMETRY_STACK_WORDS (1024)
+
+// Print measurements
+#define PRINT_INTERVAL_TICKS pdMS_TO_TICKS(1000)
+
+// Sequence number of the message that ends the stream
+#define END_OF_STREAM UINT32_MAX
+
+extern uint32_t SystemCoreClock;
+
+static QueueHandle_t process_queue;
+static QueueHandle_t render_queue;
+static QueueHandle_t telemetry_queue;
+static SemaphoreHandle_t camera_buffer_free;
+static SemaphoreHandle_t gpu_mutex;
+// Free places for frames between convert and render, NULL when the frames in flight are not bounded
+static SemaphoreHandle_t frame_slots;
+static TaskHandle_t capture_task_handle;
+static void (*finished_callback)(void);
+static volatile uint32_t telemetry_dropped;
+
+static void send_end_of_stream(QueueHandle_t queue) {
+    pipeline_frame_t end = {.sequence = END_OF_STREAM};
+    xQueueSend(queue, &end, portMAX_DELAY);
+}
+
+static void frame_slot_take(void) {
+    if (frame_slots) {
+        xSemaphoreTake(frame_slots, portMAX_DELAY);
+    }
+}
+
+static void frame_slot_give(void) {
+    if (frame_slots) {
+        xSemaphoreGive(frame_slots);
+    }
+}
+
+static void capture_task(void *arg) {
+    (void)arg;
+    for (;;) {
+        // The previous frame must be out of the camera frame buffer
+        xSemaphoreTake(camera_buffer_free, portMAX_DELAY);
+
+        pipeline_frame_t frame;
+        int ret = pipeline_capture(&frame);
+        if (ret != ARM_DRIVER_OK) {
+            printf("\r\n Error: CAMERA Capture Frame failed.\r\n");
+            break;
+        }
+        xQueueSend(process_queue, &frame, portMAX_DELAY);
+    }
+
+    send_end_of_stream(process_queue);
+    vTaskDelete(NULL);
+}
+
+static void process_task(void *arg) {
+    (void)arg;
+    pipeline_frame_t frame;
+    for (;;) {
+        xQueueReceive(process_queue, &frame, portMAX_DELAY);
+        if (frame.sequence == END_OF_STREAM) {
+            break;
+        }
+
+        // The detached image stays in video memory until the frame is rendered
+        frame_slot_take();
+        bool ok = pipeline_convert(&frame) && pipeline_detach(&frame);
+        xSemaphoreGive(camera_buffer_free);
+        if (!ok) {
+            pipeline_release(&frame);
+            frame_slot_give();
+            break;
+        }
+
+        pipeline_process(&frame);
+        xQueueSend(render_queue, &frame, portMAX_DELAY);
+    }
+
+    send_end_of_stream(render_queue);
+    vTaskDelete(NULL);
+}
+
+static void render_task(void *arg) {
+    (void)arg;
+    pipeline_frame_t frame;
+    for (;;) {
+        xQueueReceive(render_queue, &frame, portMAX_DELAY);
+        if (frame.sequence == END_OF_STREAM) {
+            break;
+        }
+
+        pipeline_render(&frame);
+        frame_slot_give();
+        if (xQueueSend(telemetry_queue, &frame, 0) != pdTRUE) {
+            telemetry_dropped++;
+        }
+    }
+
+    send_end_of_stream(telemetry_queue);
+    vTaskDelete(NULL);
+}
+
+static void telemetry_task(void *arg) {
+    (void)arg;
+    printf("\r\n Let's Start Capturing Camera Frame...\r\n");
+
+    TickType_t print_ticks = xTaskGetTickCount();
+    uint32_t frames_since_print = 0;
+    uint32_t frames_shown = 0;
+    pipeline_frame_t frame;
+    for (;;) {
+        xQueueReceive(telemetry_queue, &frame, portMAX_DELAY);
+        if (frame.sequence == END_OF_STREAM) {
+            break;
+        }
+
+        pipeline_account_energy(&frame);
+        energy_model_frame_done();
+        frames_since_print++;
+        frames_shown++;
+
+        TickType_t elapsed = xTaskGetTickCount() - print_ticks;
+        if (elapsed >= PRINT_INTERVAL_TICKS) {
+            print_ticks += elapsed;
+            float interval_s = (float)elapsed / configTICK_RATE_HZ;
+            printf("Display rate %.1f FPS at %u MHz\r\n", frames_since_print / interval_s,
+                   (unsigned)(SystemCoreClock / 1000000));
+            frames_since_print = 0;
+            // Frames whose statistics were dropped are shown but not counted
+            printf("Frames captured %u, shown %u, statistics dropped %u\r\n", (unsigned)(frame.sequence + 1),
+                   (unsigned)frames_shown, (unsigned)telemetry_dropped);
+            energy_model_print();
+            pipeline_print_stats(&frame);
+        }
+    }
+
+    energy_model_print_summary();
+    if (finished_callback) {
+        finished_callback();
+    }
+    vTaskDelete(NULL);
+}
+
+void pipeline_rtos_gpu_lock(void) {
+    if (gpu_mutex) {
+        xSemaphoreTake(gpu_mutex, portMAX_DELAY);
+    }
+}
+
+void pipeline_rtos_gpu_unlock(void) {
+    if (gpu_mutex) {
+        xSemaphoreGive(gpu_mutex);
+    }
+}
+
+/* Camera events wake up the capture task instead of the WFI loop of camera.c */
+void camera_event_wait(void) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+}
+
+void camera_event_signal(void) {
+    if (capture_task_handle) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(capture_task_handle, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+}
+
+/*
+ * The kernel owns SysTick in the RTOS build. The SysTick handler of the
+ * retarget layer is renamed in this build (see viewfinder.cproject.yml) and
+ * called from the tick hook, so that clock() keeps counting milliseconds.
+ */
+extern void retarget_SysTick_Handler(void) __attribute__((weak));
+
+void vApplicationTickHook(void) {
+    if (retarget_SysTick_Handler) {
+        retarget_SysTick_Handler();
+    }
+}
+
+void vApplicationIdleHook(void) {
+    __WFI();
+}
+
+void vApplicationStackOverflowHook(TaskHandle_t task, char *name) {
+    (void)task;
+    printf("\r\nError: stack overflow in task %s\r\n", name);
+    __BKPT(0);
+}
+
+void vApplicationMallocFailedHook(void) {
+    printf("\r\nError: FreeRTOS heap exhausted\r\n");
+    __BKPT(0);
+}
+
+void pipeline_rtos_start(void (*finished)(void)) {
+    finished_callback = finished;
+
+    process_queue = xQueueCreate(PIPELINE_RTOS_QUEUE_DEPTH, sizeof(pipeline_frame_t));
+    render_queue = xQueueCreate(PIPELINE_RTOS_QUEUE_DEPTH, sizeof(pipeline_frame_t));
+    telemetry_queue = xQueueCreate(TELEMETRY_QUEUE_DEPTH, sizeof(pipeline_frame_t));
+    camera_buffer_free = xSemaphoreCreateBinary();
+    gpu_mutex = xSemaphoreCreateMutex();
+    if (!process_queue || !render_queue || !telemetry_queue || !camera_buffer_free || !gpu_mutex) {
+        printf("\r\nError: pipeline queue creation failed\r\n");
+        __BKPT(0);
+    }
+    xSemaphoreGive(camera_buffer_free);
+
+    // A frame scaled by D/AVE2D keeps the whole camera image until it is rendered
+    if (work_partition_used(WORK_OP_SCALE) && work_partition_engine(WORK_OP_SCALE) == WORK_ENGINE_GPU) {
+        frame_slots = xSemaphoreCreateCounting(PIPELINE_RTOS_SCALE_FRAMES, PIPELINE_RTOS_SCALE_FRAMES);
+        if (!frame_slots) {
+            printf("\r\nError: pipeline queue creation failed\r\n");
+            __BKPT(0);
+        }
+    }
+
+    if (xTaskCreate(render_task, "render", RENDER_STACK_WORDS, NULL, RENDER_PRIORITY, NULL) != pdPASS ||
+        xTaskCreate(capture_task, "capture", CAPTURE_STACK_WORDS, NULL, CAPTURE_PRIORITY, &capture_task_handle) != pdPASS ||
+        xTaskCreate(process_task, "process", PROCESS_STACK_WORDS, NULL, PROCESS_PRIORITY, NULL) != pdPASS ||
+        xTaskCreate(telemetry_task, "telemetry", TELEMETRY_STACK_WORDS, NULL, TELEMETRY_PRIORITY, NULL) != pdPASS) {
+        printf("\r\nError: pipeline task creation failed\r\n");
+        __BKPT(0);
+    }
+
+    vTaskStartScheduler();
+
+    // Only reached if the scheduler could not start
+    printf("\r\nError: FreeRTOS scheduler start failed\r\n");
+    __BKPT(0);
+}
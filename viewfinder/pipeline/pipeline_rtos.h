@@ -0,0 +1,45 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef PIPELINE_RTOS_H_
+#define PIPELINE_RTOS_H_
+
+/*
+ * FreeRTOS build of the viewfinder pipeline (VIEWFINDER_RTOS).
+ *
+ * Every stage runs in its own task, connected by bounded queues:
+ *
+ *   capture --> process --> render --> telemetry
+ *
+ * capture waits for the camera interrupt and owns the camera frame buffer
+ * until process has converted the frame, so the next frame is
+ * captured while the previous ones are processed and drawn. process does the
+ * conversion, color correction, crop and the operations the work partition
+ * assigns to the CPU, render draws with D/AVE2D and flips the framebuffers, telemetry keeps the statistics and does
+ * all periodic UART output. Priorities, highest first: render (the display
+ * deadline), capture (re-arm the camera without delay), process, telemetry.
+ * When D/AVE2D scales, at most PIPELINE_RTOS_SCALE_FRAMES frames are between
+ * convert and render, process waits for render to free one.
+ *
+ * The same task graph runs on the FreeRTOS POSIX port in the host build.
+ */
+
+// Frames between convert and render when D/AVE2D scales, each holds a whole converted camera image in video memory
+#ifndef PIPELINE_RTOS_SCALE_FRAMES
+#define PIPELINE_RTOS_SCALE_FRAMES (2)
+#endif
+
+// Create the tasks and start the scheduler, does not return. finished is called when the camera stops.
+void pipeline_rtos_start(void (*finished)(void));
+
+// Serialise D/AVE2D use between the tasks
+void pipeline_rtos_gpu_lock(void);
+void pipeline_rtos_gpu_unlock(void);
+
+#endif  // PIPELINE_RTOS_H_
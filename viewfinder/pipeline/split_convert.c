@@ -0,0 +1,293 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#include "split_convert.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#include "aipl_color_correction.h"
+#include "aipl_demosaic.h"
+#include "aipl_lut_transform.h"
+#include "camera.h"
+#include "core_link.h"
+#include "disp.h"
+
+#if RTE_ISP || CAM_USE_RGB565
+#error "The split build converts raw Bayer frames of the CPI camera"
+#endif
+
+#if (SPLIT_CONVERT_OVERLAP < 2) || (SPLIT_CONVERT_OVERLAP % 2)
+#error "SPLIT_CONVERT_OVERLAP must be even and at least 2"
+#endif
+
+#define CACHE_LINE (32)
+
+// Written last by the HE worker, the HP core waits for it
+#define SPLIT_CONVERT_MAGIC (0x54494C53)
+
+// Share of the rows converted by the HE core is kept in these bounds
+#define HE_SHARE_MIN (0.05f)
+#define HE_SHARE_MAX (0.95f)
+
+// Weight of the last frame in the calibrated share
+#define HE_SHARE_SMOOTHING (0.25f)
+
+typedef struct __attribute__((aligned(CACHE_LINE))) {
+    volatile uint32_t magic;
+    volatile uint32_t done;    // Last job completed, HE core only
+    volatile uint32_t cycles;  // HE cycles of the last job
+    volatile uint32_t clock;   // HE core clock in Hz
+} split_he_line_t;
+
+typedef struct __attribute__((aligned(CACHE_LINE))) {
+    volatile uint32_t sequence;  // Last job posted, HP core only
+} split_hp_line_t;
+
+typedef struct __attribute__((aligned(CACHE_LINE))) {
+    const uint8_t *raw;  // Bayer frame
+    uint8_t *data;       // Converted image
+    aipl_color_format_t format;  // Of the image
+    uint32_t pitch;      // Pixels per row of both
+    uint32_t width;
+    uint32_t height;
+    uint32_t first_row;  // The HE core converts the rows from here to the bottom
+} split_job_t;
+
+typedef struct {
+    split_he_line_t he;
+    split_hp_line_t hp;
+    split_job_t job;
+} split_shared_t;
+
+// Shared SRAM, at the same address in the HE and HP images
+static split_shared_t split __attribute__((section(".noinit.core_link")));
+
+// Converted again by the HP core around the split row, both ends of the band are off by the demosaic border
+static uint8_t seam_buffer[SPLIT_CONVERT_OVERLAP * 2][CAM_FRAME_WIDTH * DISP_PIXEL_SIZE]
+    __attribute__((aligned(CACHE_LINE)));
+
+// HP side state
+static float he_share;
+static uint32_t split_row;
+static uint32_t hp_cycles;
+static uint32_t he_cycles;
+static uint32_t he_clock;
+static uint32_t wait_cycles;
+
+extern uint32_t SystemCoreClock;
+
+// Write the line back for the other core
+static void publish(volatile void *addr, int32_t size) {
+    SCB_CleanDCache_by_Addr(addr, size);
+}
+
+// Drop the cached copy to see the writes of the other core
+static void refresh(volatile void *addr, int32_t size) {
+    SCB_InvalidateDCache_by_Addr(addr, size);
+}
+
+// Demosaic and color correct the rows of a Bayer band, the band starts at an even row
+static aipl_error_t convert_rows(const uint8_t *raw, uint8_t *out, aipl_color_format_t format, uint32_t pitch,
+                                 uint32_t width, uint32_t rows) {
+    aipl_error_t aipl_ret = aipl_demosaic(raw, out, pitch, width, rows, CAM_BAYER_FORMAT, format);
+#if CAM_COLOR_CORRECTION
+    aipl_image_t image = {
+        .data = out,
+        .pitch = pitch,
+        .width = width,
+        .height = rows,
+        .format = format
+    };
+    if (aipl_ret == AIPL_ERR_OK) {
+        aipl_ret = aipl_color_correction_rgb_img(&image, &image, camera_get_color_correction_matrix());
+    }
+    if (aipl_ret == AIPL_ERR_OK) {
+        aipl_ret = aipl_lut_transform_rgb_img(&image, &image, camera_get_gamma_lut());
+    }
+#endif
+    return aipl_ret;
+}
+
+// Split row for the current share, even to keep the Bayer phase of both parts
+static uint32_t share_to_row(uint32_t height) {
+    uint32_t row = (uint32_t)(height * (1.0f - he_share)) & ~1U;
+    if (row < SPLIT_CONVERT_OVERLAP) {
+        row = SPLIT_CONVERT_OVERLAP;
+    }
+    if (row > height - SPLIT_CONVERT_OVERLAP) {
+        row = height - SPLIT_CONVERT_OVERLAP;
+    }
+    return row;
+}
+
+// Move the share towards equal finishing times from the measured rows per second of both cores
+static void calibrate(uint32_t height) {
+    float hp_time_s = (float)hp_cycles / SystemCoreClock;
+    float he_time_s = (float)he_cycles / he_clock;
+    if (hp_time_s <= 0.0f || he_time_s <= 0.0f) {
+        return;
+    }
+
+    float hp_rate = split_row / hp_time_s;
+    float he_rate = (height - split_row) / he_time_s;
+    he_share += (he_rate / (hp_rate + he_rate) - he_share) * HE_SHARE_SMOOTHING;
+    if (he_share < HE_SHARE_MIN) {
+        he_share = HE_SHARE_MIN;
+    }
+    if (he_share > HE_SHARE_MAX) {
+        he_share = HE_SHARE_MAX;
+    }
+}
+
+void split_convert_connect(void) {
+    core_link_doorbell_init();
+
+    for (;;) {
+        refresh(&split.he, sizeof(split.he));
+        if (split.he.magic == SPLIT_CONVERT_MAGIC) {
+            break;
+        }
+        core_link_doorbell_wait();
+    }
+
+    // Continue after the last job of the worker and start from the clock ratio of the cores
+    split.hp.sequence = split.he.done;
+    he_clock = split.he.clock;
+    he_share = (float)he_clock / (he_clock + SystemCoreClock);
+}
+
+bool split_convert(const aipl_image_t *raw, aipl_image_t *image) {
+    const uint32_t px_size = aipl_color_format_depth(image->format) / 8;
+    if (raw->pitch != image->pitch || raw->height != image->height || image->pitch > CAM_FRAME_WIDTH ||
+        px_size > DISP_PIXEL_SIZE) {
+        printf("Error: split conversion needs the frame and image of the same size\r\n");
+        return false;
+    }
+
+    const uint32_t height = image->height;
+    const uint32_t row_bytes = image->pitch * px_size;
+    split_row = share_to_row(height);
+
+    // Nothing of the HP core may be written back into the rows of the HE core while it converts them
+    uint8_t *he_rows = (uint8_t *)image->data + split_row * row_bytes;
+    SCB_CleanInvalidateDCache_by_Addr(he_rows, (height - split_row) * row_bytes);
+
+    split.job.raw = raw->data;
+    split.job.data = image->data;
+    split.job.format = image->format;
+    split.job.pitch = image->pitch;
+    split.job.width = image->width;
+    split.job.height = height;
+    split.job.first_row = split_row;
+    publish(&split.job, sizeof(split.job));
+
+    // Publish the job before the new sequence
+    __DMB();
+    uint32_t sequence = split.hp.sequence + 1;
+    split.hp.sequence = sequence;
+    publish(&split.hp, sizeof(split.hp));
+    core_link_doorbell_ring();
+
+    // Top part on this core meanwhile
+    uint32_t cycles = ARM_PMU_Get_CCNTR();
+    aipl_error_t aipl_ret = convert_rows(raw->data, image->data, image->format, image->pitch, image->width, split_row);
+    hp_cycles = ARM_PMU_Get_CCNTR() - cycles;
+
+    // Barrier, wait for the bottom part
+    cycles = ARM_PMU_Get_CCNTR();
+    for (;;) {
+        refresh(&split.he, sizeof(split.he));
+        if (split.he.done == sequence) {
+            break;
+        }
+        core_link_doorbell_wait();
+    }
+    wait_cycles = ARM_PMU_Get_CCNTR() - cycles;
+    he_cycles = split.he.cycles;
+
+    // Drop lines of the HE rows fetched in the meantime, before the seam rows are written over them
+    refresh(he_rows, (height - split_row) * row_bytes);
+
+    // Rows next to the split again from a band reaching into both parts
+    const uint32_t seam_first = split_row - SPLIT_CONVERT_OVERLAP;
+    if (aipl_ret == AIPL_ERR_OK) {
+        aipl_ret = convert_rows((const uint8_t *)raw->data + seam_first * raw->pitch, &seam_buffer[0][0],
+                                image->format, image->pitch, image->width, SPLIT_CONVERT_OVERLAP * 2);
+    }
+    if (aipl_ret != AIPL_ERR_OK) {
+        printf("\r\nError: Split Bayer conversion failed (%s)\r\n", aipl_error_str(aipl_ret));
+        return false;
+    }
+    memcpy((uint8_t *)image->data + (split_row - SPLIT_CONVERT_OVERLAP / 2) * row_bytes,
+           seam_buffer[SPLIT_CONVERT_OVERLAP / 2], SPLIT_CONVERT_OVERLAP * row_bytes);
+
+    calibrate(height);
+    return true;
+}
+
+void split_convert_print_stats(void) {
+    printf("Split conversion: HE %u of %u rows, HP %.3fms, HE %.3fms, barrier wait %.3fms\r\n",
+           (unsigned)(split.job.height - split_row), (unsigned)split.job.height,
+           hp_cycles * 1000.0f / SystemCoreClock, he_cycles * 1000.0f / he_clock,
+           wait_cycles * 1000.0f / SystemCoreClock);
+}
+
+void split_convert_worker(void) {
+    core_link_doorbell_init();
+
+    // Invalidate the state of an earlier run, jobs posted before this boot are not converted
+    split.he.magic = 0;
+    publish(&split.he, sizeof(split.he));
+
+    refresh(&split.hp, sizeof(split.hp));
+    uint32_t sequence = split.hp.sequence;
+    split.he.done = sequence;
+    split.he.cycles = 0;
+    split.he.clock = SystemCoreClock;
+    publish(&split.he, sizeof(split.he));
+
+    __DMB();
+    split.he.magic = SPLIT_CONVERT_MAGIC;
+    publish(&split.he, sizeof(split.he));
+    core_link_doorbell_ring();
+
+    for (;;) {
+        refresh(&split.hp, sizeof(split.hp));
+        if (split.hp.sequence == sequence) {
+            core_link_doorbell_wait();
+            continue;
+        }
+        // Read the job only after seeing the sequence that published it
+        __DMB();
+        sequence = split.hp.sequence;
+        refresh(&split.job, sizeof(split.job));
+
+        uint32_t cycles = ARM_PMU_Get_CCNTR();
+        const uint32_t rows = split.job.height - split.job.first_row;
+        const uint8_t *raw = split.job.raw + split.job.first_row * split.job.pitch;
+        const uint32_t row_bytes = split.job.pitch * aipl_color_format_depth(split.job.format) / 8;
+        uint8_t *out = split.job.data + split.job.first_row * row_bytes;
+
+        // The frame was written by the camera DMA of the HP core
+        refresh((void *)raw, rows * split.job.pitch);
+        // An error leaves the rows unconverted, the HP core shows them as they are
+        convert_rows(raw, out, split.job.format, split.job.pitch, split.job.width, rows);
+        // Write back and drop the rows, nothing of them may be evicted later over the memory of the HP core
+        SCB_CleanInvalidateDCache_by_Addr(out, rows * row_bytes);
+
+        split.he.cycles = ARM_PMU_Get_CCNTR() - cycles;
+        split.he.done = sequence;
+        publish(&split.he, sizeof(split.he));
+        core_link_doorbell_ring();
+    }
+}
@@ -0,0 +1,52 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef SPLIT_CONVERT_H_
+#define SPLIT_CONVERT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "aipl_image.h"
+
+/*
+ * Data-parallel Bayer conversion of the split build (DUAL_CORE_SPLIT).
+ *
+ * The M55-HP core owns the camera and the display as in the single-core
+ * build, the M55-HE core is a worker. Every frame is split into a top part
+ * converted by the HP core and a bottom part converted by the HE core at the
+ * same time: demosaic and, with CAM_COLOR_CORRECTION, color and gamma
+ * correction. Both write their rows straight into the converted image. The HE
+ * core signals completion over the MHU doorbell (the barrier), then the HP
+ * core redoes the rows next to the split from a small band with
+ * SPLIT_CONVERT_OVERLAP Bayer rows on both sides, so that the result does not
+ * depend on the split. Crop and resize stay one D/AVE2D job on the HP core.
+ *
+ * The split row follows the measured conversion rate of both cores, starting
+ * from their clock ratio (160 vs 400 MHz).
+ */
+
+// Bayer rows read across the split by the seam band, twice the demosaic kernel radius, even
+#ifndef SPLIT_CONVERT_OVERLAP
+#define SPLIT_CONVERT_OVERLAP (4)
+#endif
+
+// HP side: wait until the HE worker is running
+void split_convert_connect(void);
+
+// HP side: convert the raw Bayer frame to the image of the same size and panel format on both cores
+bool split_convert(const aipl_image_t *raw, aipl_image_t *image);
+
+// HP side: print the split row and the time of both cores for the last frame
+void split_convert_print_stats(void);
+
+// HE side: convert the bottom parts posted by the HP core, does not return
+void split_convert_worker(void);
+
+#endif  // SPLIT_CONVERT_H_
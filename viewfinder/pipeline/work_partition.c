@@ -0,0 +1,148 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#include "work_partition.h"
+
+#include <stdio.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+/*
+ * Cost per output pixel of a 480x480 display square. The crop is a view on
+ * both engines, the GPU cost is the extra time of a filtered, scaled draw
+ * over a 1:1 draw. The HE core waits fewer cycles for the SRAM at
+ * its lower clock. The autotuner (autotune.c) measures them on the board.
+ */
+#if defined(CORE_M55_HE)
+static const work_cost_t cost_table[WORK_OP_COUNT] = {
+    [WORK_OP_SCALE] = {.cpu_cycles_per_px = 5.0f, .gpu_ns_per_px = 3.0f},
+    [WORK_OP_ROTATE] = {.cpu_cycles_per_px = 2.5f, .gpu_ns_per_px = 0.5f},
+};
+#else
+static const work_cost_t cost_table[WORK_OP_COUNT] = {
+    [WORK_OP_SCALE] = {.cpu_cycles_per_px = 6.5f, .gpu_ns_per_px = 3.0f},
+    [WORK_OP_ROTATE] = {.cpu_cycles_per_px = 3.0f, .gpu_ns_per_px = 0.5f},
+};
+#endif
+
+static const char *const op_names[WORK_OP_COUNT] = {"scale", "rotate"};
+static const char *const engine_names[WORK_ENGINE_COUNT] = {"CPU", "D/AVE2D"};
+
+typedef struct {
+    work_cost_t cost;
+    uint32_t pixels;   // Output pixels per frame, 0 if not used
+    uint32_t engines;  // WORK_ENGINES_* the operation may run on
+    work_engine_t engine;
+} work_op_state_t;
+
+static work_op_state_t ops[WORK_OP_COUNT];
+static uint32_t planned_clock;
+
+// Estimated time of each engine for the plan, in seconds
+static float plan_time[WORK_ENGINE_COUNT];
+
+extern uint32_t SystemCoreClock;
+
+static float op_time_s(const work_op_state_t *op, work_engine_t engine) {
+    if (engine == WORK_ENGINE_CPU) {
+        return op->cost.cpu_cycles_per_px * op->pixels / SystemCoreClock;
+    }
+    return op->cost.gpu_ns_per_px * op->pixels * 1e-9f;
+}
+
+// Try every assignment of the few operations and keep the best
+static void plan(void) {
+    float best = -1.0f;
+    uint32_t best_assignment = 0;
+
+    for (uint32_t assignment = 0; assignment < (1U << WORK_OP_COUNT); assignment++) {
+        float time[WORK_ENGINE_COUNT] = {0.0f, 0.0f};
+        bool allowed = true;
+        for (int i = 0; i < WORK_OP_COUNT; i++) {
+            work_engine_t engine = (assignment >> i) & 1 ? WORK_ENGINE_GPU : WORK_ENGINE_CPU;
+            if (ops[i].pixels == 0) {
+                continue;
+            }
+            if (!(ops[i].engines & (1U << engine))) {
+                allowed = false;
+                break;
+            }
+            time[engine] += op_time_s(&ops[i], engine);
+        }
+        if (!allowed) {
+            continue;
+        }
+
+#if defined(VIEWFINDER_RTOS)
+        // The engines run at the same time, the slower one sets the pace
+        float total = time[WORK_ENGINE_CPU] > time[WORK_ENGINE_GPU] ? time[WORK_ENGINE_CPU] : time[WORK_ENGINE_GPU];
+#else
+        float total = time[WORK_ENGINE_CPU] + time[WORK_ENGINE_GPU];
+#endif
+        if (best < 0.0f || total < best) {
+            best = total;
+            best_assignment = assignment;
+            plan_time[WORK_ENGINE_CPU] = time[WORK_ENGINE_CPU];
+            plan_time[WORK_ENGINE_GPU] = time[WORK_ENGINE_GPU];
+        }
+    }
+
+    for (int i = 0; i < WORK_OP_COUNT; i++) {
+        ops[i].engine = (best_assignment >> i) & 1 ? WORK_ENGINE_GPU : WORK_ENGINE_CPU;
+    }
+    planned_clock = SystemCoreClock;
+}
+
+void work_partition_init(void) {
+    for (int i = 0; i < WORK_OP_COUNT; i++) {
+        ops[i].cost = cost_table[i];
+        ops[i].pixels = 0;
+        ops[i].engines = WORK_ENGINES_ALL;
+        ops[i].engine = WORK_ENGINE_CPU;
+    }
+    planned_clock = 0;
+}
+
+void work_partition_add(work_op_t op, uint32_t pixels, uint32_t engines) {
+    ops[op].pixels = pixels;
+    ops[op].engines = engines;
+    planned_clock = 0;
+}
+
+bool work_partition_used(work_op_t op) {
+    return ops[op].pixels != 0;
+}
+
+void work_partition_set_cost(work_op_t op, const work_cost_t *cost) {
+    ops[op].cost = *cost;
+    planned_clock = 0;
+}
+
+work_engine_t work_partition_engine(work_op_t op) {
+    if (planned_clock != SystemCoreClock) {
+        plan();
+    }
+    return ops[op].engine;
+}
+
+void work_partition_print(void) {
+    if (planned_clock != SystemCoreClock) {
+        plan();
+    }
+
+    printf("Work partition at %u MHz:", (unsigned)(SystemCoreClock / 1000000));
+    for (int i = 0; i < WORK_OP_COUNT; i++) {
+        if (ops[i].pixels) {
+            printf(" %s on %s", op_names[i], engine_names[ops[i].engine]);
+        }
+    }
+    printf(" (estimated CPU %.3fms, D/AVE2D %.3fms)\r\n", plan_time[WORK_ENGINE_CPU] * 1000.0f,
+           plan_time[WORK_ENGINE_GPU] * 1000.0f);
+}
@@ -0,0 +1,71 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef WORK_PARTITION_H_
+#define WORK_PARTITION_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * CPU/GPU work partitioning of the pipeline operations that can run either
+ * as an AIPL kernel on the CPU or as part of the D/AVE2D draw.
+ *
+ * Every operation has a cost per output pixel on each engine: core cycles on
+ * the CPU (Helium kernels, independent of the clock) and nanoseconds on
+ * D/AVE2D (its own clock). The defaults come from a table per core, measured
+ * costs replace them with work_partition_set_cost(). The plan assigns every
+ * operation to an engine: in the loop build the engines take turns and the
+ * plan minimizes the sum of both, in the RTOS build the render task keeps
+ * D/AVE2D busy while the process task converts the next frame and the plan
+ * balances the two (a scale on D/AVE2D bounds the frames in flight, see
+ * pipeline_rtos.h). The plan is made again when the core clock changes.
+ */
+
+typedef enum {
+    WORK_OP_SCALE,   // Scale the crop to its size on the panel (layout.h)
+    WORK_OP_ROTATE,  // Rotate by 180 degrees
+    WORK_OP_COUNT
+} work_op_t;
+
+typedef enum {
+    WORK_ENGINE_CPU,
+    WORK_ENGINE_GPU,
+    WORK_ENGINE_COUNT
+} work_engine_t;
+
+// Engines an operation may be assigned to
+#define WORK_ENGINES_CPU (1U << WORK_ENGINE_CPU)
+#define WORK_ENGINES_GPU (1U << WORK_ENGINE_GPU)
+#define WORK_ENGINES_ALL (WORK_ENGINES_CPU | WORK_ENGINES_GPU)
+
+typedef struct {
+    float cpu_cycles_per_px;  // AIPL kernel, core cycles per output pixel
+    float gpu_ns_per_px;      // D/AVE2D, added draw time per output pixel
+} work_cost_t;
+
+// Load the cost table of this core, no operations are used yet
+void work_partition_init(void);
+
+// Use the operation on pixels output pixels per frame, on one of the engines
+void work_partition_add(work_op_t op, uint32_t pixels, uint32_t engines);
+
+// Whether the build uses the operation
+bool work_partition_used(work_op_t op);
+
+// Replace the table cost of the operation, for example with one measured at boot
+void work_partition_set_cost(work_op_t op, const work_cost_t *cost);
+
+// Engine of the operation for the current core clock, plans again if the clock changed
+work_engine_t work_partition_engine(work_op_t op);
+
+// Print the assignment and the estimated time on each engine
+void work_partition_print(void);
+
+#endif  // WORK_PARTITION_H_
@@ -0,0 +1,121 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#include "dvfs.h"
+
+#include <stdio.h>
+
+#include "power_management.h"
+
+// Share of the frame period the processing may use, leaves room for the frame-to-frame variation
+#ifndef DVFS_UP_THRESHOLD_PCT
+#define DVFS_UP_THRESHOLD_PCT (85)
+#endif
+
+// A lower operating point is chosen only when the load would stay below this share of its frame period
+#ifndef DVFS_DOWN_THRESHOLD_PCT
+#define DVFS_DOWN_THRESHOLD_PCT (70)
+#endif
+
+// Consecutive frames that must fit the lower operating point before switching down
+#ifndef DVFS_DOWN_FRAMES
+#define DVFS_DOWN_FRAMES (30)
+#endif
+
+typedef struct {
+    clock_frequency_t cpu_clk_freq;
+    uint32_t mhz;
+    uint32_t dcdc_voltage;  // mV
+} operating_point_t;
+
+// Operating points from the highest to the lowest clock
+static const operating_point_t operating_points[] = {
+#if defined(CORE_M55_HP)
+    { CLOCK_FREQUENCY_400MHZ, 400, 825 },
+    { CLOCK_FREQUENCY_300MHZ, 300, 800 },
+    { CLOCK_FREQUENCY_200MHZ, 200, 775 },
+    { CLOCK_FREQUENCY_100MHZ, 100, 750 },
+#elif defined(CORE_M55_HE)
+    { CLOCK_FREQUENCY_160MHZ, 160, 825 },
+    { CLOCK_FREQUENCY_120MHZ, 120, 800 },
+    { CLOCK_FREQUENCY_80MHZ, 80, 775 },
+    { CLOCK_FREQUENCY_60MHZ, 60, 750 },
+#else
+#error Unsupported core
+#endif
+};
+
+#define NUM_OPERATING_POINTS (sizeof(operating_points) / sizeof(operating_points[0]))
+
+static uint32_t frame_rate;
+static uint32_t current_op;
+static uint32_t frames_below;
+static uint32_t window_peak_kcycles;  // Highest load since the last switch or the last frame that did not fit
+
+// Frame budget in units of 1000 cycles at an operating point for the given share of the frame period
+static uint32_t budget_kcycles(uint32_t op, uint32_t pct) {
+    return operating_points[op].mhz * 1000 / frame_rate * pct / 100;
+}
+
+static void apply(uint32_t op) {
+    const operating_point_t *point = &operating_points[op];
+    if (pm_set_cpu_clock(point->cpu_clk_freq, point->mhz * 1000000, point->dcdc_voltage)) {
+        printf("DVFS: %u MHz, %u mV\r\n", (unsigned)point->mhz, (unsigned)point->dcdc_voltage);
+        current_op = op;
+    }
+    frames_below = 0;
+    window_peak_kcycles = 0;
+}
+
+void dvfs_init(uint32_t target_fps) {
+    frame_rate = target_fps;
+    if (frame_rate) {
+        apply(0);
+    }
+}
+
+void dvfs_frame_done(uint32_t active_cycles) {
+    if (frame_rate == 0) {
+        return;
+    }
+
+    // The cycle count of the work hardly depends on the clock, so it is compared against the cycle budget of each point
+    uint32_t load_kcycles = active_cycles / 1000;
+
+    // Over budget: go directly to the lowest operating point that fits, or the highest one
+    if (load_kcycles > budget_kcycles(current_op, DVFS_UP_THRESHOLD_PCT)) {
+        uint32_t op = current_op;
+        while (op > 0 && load_kcycles > budget_kcycles(op, DVFS_UP_THRESHOLD_PCT)) {
+            op--;
+        }
+        if (op != current_op) {
+            apply(op);
+        }
+        return;
+    }
+
+    // Below budget of the next lower operating point for long enough: step down by one
+    if (current_op + 1 < NUM_OPERATING_POINTS) {
+        if (load_kcycles > window_peak_kcycles) {
+            window_peak_kcycles = load_kcycles;
+        }
+        if (window_peak_kcycles <= budget_kcycles(current_op + 1, DVFS_DOWN_THRESHOLD_PCT)) {
+            if (++frames_below >= DVFS_DOWN_FRAMES) {
+                apply(current_op + 1);
+            }
+        } else {
+            frames_below = 0;
+            window_peak_kcycles = 0;
+        }
+    }
+}
+
+uint32_t dvfs_current_mhz(void) {
+    return operating_points[current_op].mhz;
+}
@@ -0,0 +1,34 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef DVFS_H_
+#define DVFS_H_
+
+#include <stdint.h>
+
+/*
+ * Frame-load driven DVFS governor.
+ *
+ * Picks the lowest CPU clock and DCDC voltage from the operating point table
+ * that still processes a frame within the target frame period, based on the
+ * active cycles of the previous frames. The clock is raised as soon as a frame
+ * does not fit the budget and lowered only after DVFS_DOWN_FRAMES frames in a
+ * row would have fit the lower operating point with margin.
+ */
+
+// Start the governor at the highest operating point, target_fps 0 disables it
+void dvfs_init(uint32_t target_fps);
+
+// Report the active (non-idle) cycles spent on the last frame at the current clock
+void dvfs_frame_done(uint32_t active_cycles);
+
+// Current CPU clock in MHz
+uint32_t dvfs_current_mhz(void);
+
+#endif  // DVFS_H_
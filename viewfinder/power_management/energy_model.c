@@ -0,0 +1,152 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#include "energy_model.h"
+
+#include <stdio.h>
+
+#include "power_management.h"
+
+extern uint32_t SystemCoreClock;
+
+static const char *const stage_names[ENERGY_STAGE_COUNT] = {
+    "capture", "convert", "color correction", "processing", "render", "idle",
+};
+
+// Run profile clock enables of the blocks
+static const uint32_t block_masks[ENERGY_BLOCK_COUNT] = {
+    CAMERA_MASK, MIPI_CSI_MASK, MIPI_DSI_MASK, CDC200_MASK, GPU_MASK,
+};
+
+// Rough figures for the default run profile, replace them with calibrated ones for the board in use
+static energy_coefficients_t coefficients = {
+#if defined(CORE_M55_HE)
+    .core_uw_per_mhz = 25.0f,
+    .core_static_uw = 1500.0f,
+#else
+    .core_uw_per_mhz = 45.0f,
+    .core_static_uw = 4000.0f,
+#endif
+    .core_sleep_uw = 1000.0f,
+    .nominal_voltage_mv = 825.0f,
+    .block_uw = { 1500.0f, 4000.0f, 6000.0f, 5000.0f, 1500.0f },
+    .gpu_active_uw = 20000.0f,
+    .scale = 1.0f,
+};
+
+// Energy of the current frame, since the last print, and since start-up in uJ
+static float frame_uj[ENERGY_STAGE_COUNT];
+static float interval_uj[ENERGY_STAGE_COUNT];
+static uint32_t interval_frames;
+static float total_uj;
+static uint32_t total_frames;
+static float frame_s;
+static float total_s;
+static float calibration_start_uj;
+
+energy_coefficients_t *energy_model_coefficients(void) {
+    return &coefficients;
+}
+
+// Power in uW during a stage with the active run profile
+static float stage_power_uw(energy_stage_t stage) {
+    const run_profile_t *runprof = pm_get_run_profile();
+    float voltage = runprof->dcdc_voltage / coefficients.nominal_voltage_mv;
+    float mhz = SystemCoreClock / 1000000.0f;
+
+    float power;
+    if (stage == ENERGY_STAGE_CAPTURE || stage == ENERGY_STAGE_IDLE) {
+        power = coefficients.core_sleep_uw * voltage;
+    } else {
+        power = coefficients.core_uw_per_mhz * mhz * voltage * voltage + coefficients.core_static_uw * voltage;
+    }
+
+    for (int block = 0; block < ENERGY_BLOCK_COUNT; block++) {
+        if (runprof->ip_clock_gating & block_masks[block]) {
+            power += coefficients.block_uw[block];
+        }
+    }
+
+    if (stage == ENERGY_STAGE_RENDER) {
+        power += coefficients.gpu_active_uw;
+    }
+    return power * coefficients.scale;
+}
+
+void energy_model_add_stage(energy_stage_t stage, uint32_t cycles) {
+    float seconds = (float)cycles / SystemCoreClock;
+    frame_uj[stage] += stage_power_uw(stage) * seconds;
+    frame_s += seconds;
+}
+
+void energy_model_frame_done(void) {
+    for (int stage = 0; stage < ENERGY_STAGE_COUNT; stage++) {
+        interval_uj[stage] += frame_uj[stage];
+        total_uj += frame_uj[stage];
+        frame_uj[stage] = 0.0f;
+    }
+    total_s += frame_s;
+    frame_s = 0.0f;
+    interval_frames++;
+    total_frames++;
+}
+
+float energy_model_average_power_uw(void) {
+    if (total_s > 0.0f) {
+        return total_uj / total_s;
+    }
+    return stage_power_uw(ENERGY_STAGE_CONVERT);
+}
+
+void energy_model_print(void) {
+    if (interval_frames == 0) {
+        return;
+    }
+
+    float frame_total = 0.0f;
+    for (int stage = 0; stage < ENERGY_STAGE_COUNT; stage++) {
+        frame_total += interval_uj[stage];
+    }
+    printf("Energy per frame %.3f mJ (estimate):", frame_total / interval_frames / 1000.0f);
+    for (int stage = 0; stage < ENERGY_STAGE_COUNT; stage++) {
+        if (interval_uj[stage] > 0.0f) {
+            printf(" %s %.0fuJ", stage_names[stage], interval_uj[stage] / interval_frames);
+        }
+        interval_uj[stage] = 0.0f;
+    }
+    printf("\r\n");
+    interval_frames = 0;
+}
+
+void energy_model_print_summary(void) {
+    if (total_frames) {
+        printf("Energy summary: %u frames, %.3f mJ per frame (estimate)\r\n", (unsigned)total_frames,
+               total_uj / total_frames / 1000.0f);
+    }
+}
+
+__attribute__((weak)) void energy_model_meter_marker(bool start) {
+    (void)start;
+}
+
+void energy_model_calibration_start(void) {
+    calibration_start_uj = total_uj;
+    energy_model_meter_marker(true);
+}
+
+void energy_model_calibration_end(float measured_mj) {
+    energy_model_meter_marker(false);
+
+    float estimated_mj = (total_uj - calibration_start_uj) / 1000.0f;
+    if (estimated_mj > 0.0f && measured_mj > 0.0f) {
+        coefficients.scale *= measured_mj / estimated_mj;
+        printf("Energy model calibrated: estimated %.3f mJ, measured %.3f mJ, scale %.3f\r\n", estimated_mj, measured_mj,
+               coefficients.scale);
+    }
+}
@@ -0,0 +1,80 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef ENERGY_MODEL_H_
+#define ENERGY_MODEL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Per-frame energy estimate.
+ *
+ * Each pipeline stage reports the cycles it took at the current core clock.
+ * The energy of a stage is its duration times the power of the core at the
+ * clock and DCDC voltage of the active run profile, plus the power of every IP
+ * block whose clock is enabled in the run profile ip_clock_gating mask, plus
+ * the GPU while rendering. The coefficients are rough defaults: calibrate them
+ * against an external meter with energy_model_calibration_start()/_end().
+ */
+typedef enum {
+    ENERGY_STAGE_CAPTURE = 0,       // Waiting for the camera frame (core sleeping)
+    ENERGY_STAGE_CONVERT,           // Bayer or YUY2 to RGB565
+    ENERGY_STAGE_COLOR_CORRECTION,
+    ENERGY_STAGE_PROCESSING,        // Crop, resize, rotate
+    ENERGY_STAGE_RENDER,            // D/AVE2D drawing
+    ENERGY_STAGE_IDLE,              // Sleeping between frames
+    ENERGY_STAGE_COUNT
+} energy_stage_t;
+
+typedef enum {
+    ENERGY_BLOCK_CAMERA = 0,
+    ENERGY_BLOCK_MIPI_CSI,
+    ENERGY_BLOCK_MIPI_DSI,
+    ENERGY_BLOCK_CDC200,
+    ENERGY_BLOCK_GPU,
+    ENERGY_BLOCK_COUNT
+} energy_block_t;
+
+typedef struct {
+    float core_uw_per_mhz;              // Core dynamic power at the nominal voltage
+    float core_static_uw;               // Core and SRAM leakage at the nominal voltage
+    float core_sleep_uw;                // Core clock gated in WFI, at the nominal voltage
+    float nominal_voltage_mv;
+    float block_uw[ENERGY_BLOCK_COUNT]; // IP block with its clock enabled
+    float gpu_active_uw;                // GPU drawing, on top of block_uw[ENERGY_BLOCK_GPU]
+    float scale;                        // Calibration factor applied to every estimate
+} energy_coefficients_t;
+
+// Coefficients in use, can be changed at any time
+energy_coefficients_t *energy_model_coefficients(void);
+
+// Add the cycles of a stage of the current frame, measured at the current core clock
+void energy_model_add_stage(energy_stage_t stage, uint32_t cycles);
+
+// Close the current frame
+void energy_model_frame_done(void);
+
+// Average power of the frames since start-up in uW, the power of the running core before the first frame
+float energy_model_average_power_uw(void);
+
+// Print the average energy per frame and stage since the last call
+void energy_model_print(void);
+
+// Print the average energy per frame since start-up
+void energy_model_print_summary(void);
+
+// Calibration: measure the energy with an external meter between start and end, end updates the scale
+void energy_model_calibration_start(void);
+void energy_model_calibration_end(float measured_mj);
+
+// Called at calibration start (true) and end (false), override to trigger the meter, e.g. with a GPIO
+void energy_model_meter_marker(bool start);
+
+#endif  // ENERGY_MODEL_H_
@@ -0,0 +1,205 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#include "frame_governor.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#include "Driver_LPTIMER.h"
+#include "aipl_dave2d.h"
+#include "pm.h"
+#include "power_management.h"
+
+/*
+ * IP clocks gated while sleeping between frames. The CDC200 has to keep
+ * scanning out the framebuffer for video mode panels, so its clock is only
+ * gated when FRAME_GOVERNOR_GATE_CDC is set (panels with their own frame memory).
+ */
+#if FRAME_GOVERNOR_GATE_CDC
+#define IDLE_GATED_CLOCKS (GPU_MASK | CDC200_MASK)
+#else
+#define IDLE_GATED_CLOCKS (GPU_MASK)
+#endif
+
+// LPTIMER channel that wakes the core from deep sleep between frames, channel 0 is the standby wake-up timer
+#ifndef FRAME_GOVERNOR_LPTIMER_CHANNEL
+#define FRAME_GOVERNOR_LPTIMER_CHANNEL (1)
+#endif
+#define LPTIMER_CLOCK_HZ (32768)
+
+// Shorter idle windows sleep in WFI and wake on every SysTick, deep sleep does not pay off for them
+#ifndef FRAME_GOVERNOR_MIN_DEEP_SLEEP_MS
+#define FRAME_GOVERNOR_MIN_DEEP_SLEEP_MS (2)
+#endif
+
+// Estimate of one SE run profile update before the first one has been measured
+#ifndef FRAME_GOVERNOR_SE_CALL_US
+#define FRAME_GOVERNOR_SE_CALL_US (200)
+#endif
+
+// SysTick interrupt of the retarget layer, one call per clock() tick
+extern void SysTick_Handler(void);
+
+extern ARM_DRIVER_LPTIMER DRIVER_LPTIMER0;
+static ARM_DRIVER_LPTIMER *lptimer = &DRIVER_LPTIMER0;
+static volatile bool wake_timer_expired;
+
+static uint32_t frame_rate;
+static clock_t frame_period;
+static clock_t next_frame_start;
+static clock_t last_sleep;
+static uint32_t se_call_us = FRAME_GOVERNOR_SE_CALL_US;
+
+// Statistics since the last print
+static clock_t stats_start;
+static clock_t busy_time;
+static clock_t busy_start;
+static uint32_t frames;
+static uint32_t overruns;
+static uint32_t deep_sleeps;
+static uint32_t ungated_sleeps;
+
+static void wake_timer_event(uint8_t event) {
+    if (event & ARM_LPTIMER_EVENT_UNDERFLOW) {
+        wake_timer_expired = true;
+    }
+}
+
+// Run profile update through the SE, the measured time feeds the estimate used to skip short idle windows
+static void set_ip_clock_gating(uint32_t ip_clocks) {
+    uint32_t cycles = ARM_PMU_Get_CCNTR();
+    pm_set_ip_clock_gating(ip_clocks);
+    cycles = ARM_PMU_Get_CCNTR() - cycles;
+    uint32_t us = cycles / (SystemCoreClock / 1000000);
+    se_call_us = (se_call_us * 3 + us) / 4;
+}
+
+/*
+ * Deep sleep until the LPTIMER expires. SysTick stops in deep sleep, its
+ * interrupt is masked meanwhile and the missed clock() ticks are counted
+ * afterwards. Other interrupts (display, camera) are served and the core
+ * goes back to sleep until the timer.
+ */
+static void deep_sleep(clock_t ticks) {
+    uint32_t count = (uint64_t)ticks * LPTIMER_CLOCK_HZ / CLOCKS_PER_SEC;
+    wake_timer_expired = false;
+    lptimer->Control(FRAME_GOVERNOR_LPTIMER_CHANNEL, ARM_LPTIMER_SET_COUNT1, &count);
+    lptimer->Start(FRAME_GOVERNOR_LPTIMER_CHANNEL);
+
+    SysTick->CTRL &= ~SysTick_CTRL_TICKINT_Msk;
+    while (!wake_timer_expired) {
+        pm_core_enter_deep_sleep();
+    }
+    SysTick->CTRL |= SysTick_CTRL_TICKINT_Msk;
+    lptimer->Stop(FRAME_GOVERNOR_LPTIMER_CHANNEL);
+
+    for (clock_t i = 0; i < ticks; i++) {
+        SysTick_Handler();
+    }
+}
+
+void frame_governor_init(uint32_t target_fps) {
+    frame_rate = target_fps;
+    frame_period = target_fps ? CLOCKS_PER_SEC / target_fps : 0;
+    next_frame_start = clock();
+    stats_start = next_frame_start;
+    busy_start = next_frame_start;
+    busy_time = 0;
+    frames = 0;
+    overruns = 0;
+    deep_sleeps = 0;
+    ungated_sleeps = 0;
+
+    if (frame_period) {
+        lptimer->Initialize(FRAME_GOVERNOR_LPTIMER_CHANNEL, wake_timer_event);
+        lptimer->PowerControl(FRAME_GOVERNOR_LPTIMER_CHANNEL, ARM_POWER_FULL);
+    }
+}
+
+void frame_governor_wait_frame_start(void) {
+    clock_t now = clock();
+    busy_time += now - busy_start;
+    last_sleep = 0;
+
+    if (frame_period) {
+        if ((long)(now - next_frame_start) >= 0) {
+            // Previous frame ran past its slot: start now and realign the schedule
+            if (frames && now != next_frame_start) {
+                overruns++;
+            }
+            next_frame_start = now;
+        } else {
+            clock_t idle = next_frame_start - now;
+            uint32_t idle_us = (uint32_t)((uint64_t)idle * 1000000 / CLOCKS_PER_SEC);
+
+            // Gating and ungating are two SE round trips, not worth it for a shorter idle window
+            uint32_t ip_clocks = pm_get_run_profile()->ip_clock_gating;
+            bool gate = idle_us > 2 * se_call_us;
+            if (gate) {
+                // The GPU clock may only stop once D/AVE2D has finished the last render
+                d2_flushframe(aipl_dave2d_handle());
+                set_ip_clock_gating(ip_clocks & ~IDLE_GATED_CLOCKS);
+            } else {
+                ungated_sleeps++;
+            }
+
+            idle = next_frame_start - clock();
+            if ((long)idle >= (long)(FRAME_GOVERNOR_MIN_DEEP_SLEEP_MS * CLOCKS_PER_SEC / 1000)) {
+                deep_sleep(idle);
+                deep_sleeps++;
+            }
+            // Rest of the window, SysTick wakes the core up every clock() tick
+            while ((long)(clock() - next_frame_start) < 0) {
+                __WFI();
+            }
+
+            if (gate) {
+                set_ip_clock_gating(ip_clocks);
+            }
+            last_sleep = clock() - now;
+        }
+        next_frame_start += frame_period;
+    }
+
+    busy_start = clock();
+    frames++;
+}
+
+clock_t frame_governor_last_sleep(void) {
+    return last_sleep;
+}
+
+void frame_governor_print_stats(void) {
+    clock_t now = clock();
+    clock_t elapsed = now - stats_start;
+    if (elapsed == 0) {
+        return;
+    }
+
+    float elapsed_s = (float)elapsed / CLOCKS_PER_SEC;
+    float duty_cycle = 100.0f * (busy_time + (now - busy_start)) / elapsed;
+    if (frame_period) {
+        printf("Frame governor: %.1f FPS (target %u), duty cycle %.1f%%, %u overruns, %u deep sleeps, "
+               "%u idle windows too short to gate (SE call %u us)\r\n", frames / elapsed_s, (unsigned)frame_rate,
+               duty_cycle, (unsigned)overruns, (unsigned)deep_sleeps, (unsigned)ungated_sleeps, (unsigned)se_call_us);
+    }
+
+    stats_start = now;
+    busy_start = now;
+    busy_time = 0;
+    frames = 0;
+    overruns = 0;
+    deep_sleeps = 0;
+    ungated_sleeps = 0;
+}
@@ -0,0 +1,39 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef FRAME_GOVERNOR_H_
+#define FRAME_GOVERNOR_H_
+
+#include <stdint.h>
+#include <time.h>
+
+/*
+ * Target-FPS frame governor.
+ *
+ * Starts the frame captures on a fixed period and sleeps in between with the
+ * GPU clock (and optionally the CDC200 clock) gated in the run profile.
+ * The core sleeps in deep sleep and an LPTIMER channel wakes it up, only the
+ * last clock() tick is slept in WFI. Idle windows shorter than the two SE run
+ * profile updates keep the clocks running. Frames that take longer than the
+ * period start the next capture right away.
+ */
+
+// Start scheduling frames at target_fps, 0 disables the governor (frames run back to back)
+void frame_governor_init(uint32_t target_fps);
+
+// Sleep until the start of the next frame period, call before starting the capture
+void frame_governor_wait_frame_start(void);
+
+// Time slept before the current frame, in clock() ticks
+clock_t frame_governor_last_sleep(void);
+
+// Print achieved frame rate, duty cycle and overruns since the last call
+void frame_governor_print_stats(void);
+
+#endif  // FRAME_GOVERNOR_H_
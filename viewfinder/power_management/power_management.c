@@ -10,6 +10,10 @@
 #include "power_management.h"
 
 #include <stdio.h>
+#include <time.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
 
 #include "services_lib_api.h"
 #include "services_lib_bare_metal.h"
@@ -19,6 +23,11 @@
 // SE handle
 extern uint32_t se_services_s_handle;
 
+extern uint32_t SystemCoreClock;
+
+// Run profile currently applied, changed by pm_set_cpu_clock()
+static run_profile_t current_runprof;
+
 void print_runprofile(const run_profile_t *runprof) {
     printf("memory_blocks   %08X\n", runprof->memory_blocks);
     printf("power_domains   %08X\n", runprof->power_domains);
@@ -32,7 +41,7 @@ void print_runprofile(const run_profile_t *runprof) {
     printf("dcdc_voltage    %u\n", runprof->dcdc_voltage);
 }
 
-static bool set_power_profiles(void) {
+static bool set_power_profiles(bool off_profile) {
     run_profile_t default_runprof = {0};
     off_profile_t default_offprof = {0};
 
@@ -62,13 +71,18 @@ static bool set_power_profiles(void) {
     err = SERVICES_set_run_cfg(se_services_s_handle, &default_runprof, &service_error_code);
 
     if (err == 0 && service_error_code == 0) {
+        current_runprof = default_runprof;
+    }
+
+    if (err == 0 && service_error_code == 0 && off_profile) {
+
         default_offprof.power_domains = 0;
         default_offprof.aon_clk_src = CLK_SRC_LFXO;
         default_offprof.dcdc_voltage = PM_DCDC_VOLTAGE;
         default_offprof.dcdc_mode = DCDC_MODE_PWM;
         default_offprof.stby_clk_src = CLK_SRC_HFRC;
         default_offprof.stby_clk_freq = SCALED_FREQ_RC_STDBY_38_4_MHZ;
-        default_offprof.memory_blocks = SERAM_MASK | MRAM_MASK;
+        default_offprof.memory_blocks = SERAM_MASK | MRAM_MASK | BACKUP4K_MASK;  // backup SRAM holds the standby state
         default_offprof.ip_clock_gating = LP_PERIPH_MASK;
         default_offprof.phy_pwr_gating = 0;
         default_offprof.vdd_ioflex_3V3 = IOFLEX_LEVEL_1V8;
@@ -90,5 +104,52 @@ static bool set_power_profiles(void) {
 }
 
 bool init_power_management(void) {
-    return set_power_profiles();
+    return set_power_profiles(true);
+}
+
+bool resume_power_management(void) {
+    return set_power_profiles(false);
+}
+
+static bool apply_run_profile(const run_profile_t *runprof) {
+    uint32_t service_error_code;
+    uint32_t err = SERVICES_set_run_cfg(se_services_s_handle, (run_profile_t *)runprof, &service_error_code);
+    if (err != 0 || service_error_code != 0) {
+        printf("\r\nError: run profile update failed (%u, %u)\r\n", err, service_error_code);
+        return false;
+    }
+
+    current_runprof = *runprof;
+    return true;
+}
+
+bool pm_set_cpu_clock(clock_frequency_t cpu_clk_freq, uint32_t cpu_clk_hz, uint32_t dcdc_voltage) {
+    run_profile_t runprof = current_runprof;
+    runprof.cpu_clk_freq = cpu_clk_freq;
+    runprof.dcdc_voltage = dcdc_voltage;
+
+    if (!apply_run_profile(&runprof)) {
+        return false;
+    }
+
+    SystemCoreClock = cpu_clk_hz;
+    // Keep the clock() tick rate when SysTick runs from the core clock
+    if (SysTick->CTRL & SysTick_CTRL_ENABLE_Msk) {
+        SysTick->LOAD = SystemCoreClock / CLOCKS_PER_SEC - 1;
+    }
+    return true;
+}
+
+bool pm_set_ip_clock_gating(uint32_t ip_clock_gating) {
+    if (ip_clock_gating == current_runprof.ip_clock_gating) {
+        return true;
+    }
+
+    run_profile_t runprof = current_runprof;
+    runprof.ip_clock_gating = ip_clock_gating;
+    return apply_run_profile(&runprof);
+}
+
+const run_profile_t *pm_get_run_profile(void) {
+    return &current_runprof;
 }
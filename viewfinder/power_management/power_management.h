@@ -18,5 +18,16 @@
 
 void print_runprofile(const run_profile_t *runprof);
 bool init_power_management(void);
+// Run profile only, after a wake-up from the off state the SE still has the off profile
+bool resume_power_management(void);
+
+// Change CPU clock and DCDC voltage of the run profile, SystemCoreClock is updated to cpu_clk_hz
+bool pm_set_cpu_clock(clock_frequency_t cpu_clk_freq, uint32_t cpu_clk_hz, uint32_t dcdc_voltage);
+
+// Change the clock enables of the run profile (ip_clock_gating, a set bit keeps the IP clock running)
+bool pm_set_ip_clock_gating(uint32_t ip_clock_gating);
+
+// Run profile currently applied
+const run_profile_t *pm_get_run_profile(void);
 
 #endif
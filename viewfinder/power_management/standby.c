@@ -0,0 +1,175 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#include "standby.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#include "Driver_IO.h"
+#include "Driver_LPTIMER.h"
+#include "energy_model.h"
+#include "pm.h"
+
+// Time between the single frames shown in standby
+#ifndef STANDBY_FRAME_INTERVAL_MS
+#define STANDBY_FRAME_INTERVAL_MS (2000)
+#endif
+
+// Time the full-rate viewfinder runs after a cold boot or a button wake-up
+#ifndef STANDBY_FULL_RATE_S
+#define STANDBY_FULL_RATE_S (10)
+#endif
+
+/*
+ * Average current estimate: the awake energy comes from the energy model,
+ * the off state is not modeled and uses a board figure. Measure it and the
+ * supply voltage for the board in use.
+ */
+#ifndef STANDBY_OFF_CURRENT_UA
+#define STANDBY_OFF_CURRENT_UA (60)
+#endif
+#ifndef STANDBY_SUPPLY_MV
+#define STANDBY_SUPPLY_MV (3300)
+#endif
+
+// Wake-up button on LPGPIO, active low
+#ifndef STANDBY_WAKE_GPIO_PORT
+#define STANDBY_WAKE_GPIO_PORT LP
+#define STANDBY_WAKE_GPIO_PIN  (0)
+#endif
+
+// 4 KB backup SRAM in the VBAT domain, kept in the off state
+#ifndef STANDBY_STATE_ADDR
+#define STANDBY_STATE_ADDR (0x4902C000)
+#endif
+
+#define STANDBY_STATE_MAGIC (0x53544259)  // "STBY"
+#define LPTIMER_CHANNEL     (0)
+#define LPTIMER_CLOCK_HZ    (32768)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t wakeups;           // Timer wake-ups since entering standby
+    uint32_t awake_ms;          // Total awake time of those wake-ups
+    uint32_t resume_ms;         // Total wake-up to first frame time of those wake-ups
+    uint32_t awake_uj;          // Total awake energy of those wake-ups, energy model estimate
+} standby_state_t;
+
+static standby_state_t *const state = (standby_state_t *)STANDBY_STATE_ADDR;
+
+extern ARM_DRIVER_LPTIMER DRIVER_LPTIMER0;
+static ARM_DRIVER_LPTIMER *lptimer = &DRIVER_LPTIMER0;
+
+extern ARM_DRIVER_GPIO ARM_Driver_GPIO_(STANDBY_WAKE_GPIO_PORT);
+static ARM_DRIVER_GPIO *wake_port = &ARM_Driver_GPIO_(STANDBY_WAKE_GPIO_PORT);
+
+static standby_wake_t wake_reason;
+static clock_t wake_time;
+static bool first_frame_done;
+
+standby_wake_t standby_init(void) {
+    // clock() starts at 0 in clk_init() at the start of main()
+    wake_time = 0;
+
+    wake_port->Initialize(STANDBY_WAKE_GPIO_PIN, NULL);
+    wake_port->PowerControl(STANDBY_WAKE_GPIO_PIN, ARM_POWER_FULL);
+    wake_port->SetDirection(STANDBY_WAKE_GPIO_PIN, GPIO_PIN_DIRECTION_INPUT);
+
+    if (state->magic != STANDBY_STATE_MAGIC) {
+        wake_reason = STANDBY_WAKE_COLD_BOOT;
+    } else {
+        uint32_t button = 1;
+        wake_port->GetValue(STANDBY_WAKE_GPIO_PIN, &button);
+        wake_reason = button ? STANDBY_WAKE_TIMER : STANDBY_WAKE_BUTTON;
+    }
+
+    if (wake_reason != STANDBY_WAKE_TIMER) {
+        // Full rate again, standby statistics start over with the next standby period
+        state->magic = 0;
+    }
+
+    return wake_reason;
+}
+
+standby_wake_t standby_wake_reason(void) {
+    return wake_reason;
+}
+
+static void print_average_current(void) {
+    // Awake for awake_ms / wakeups per interval, off for the rest of it
+    uint32_t awake_ms = state->awake_ms / state->wakeups;
+    if (awake_ms > STANDBY_FRAME_INTERVAL_MS) {
+        awake_ms = STANDBY_FRAME_INTERVAL_MS;
+    }
+    // uJ = uA * mV * ms / 1e6
+    uint64_t awake_uj = state->awake_uj / state->wakeups;
+    uint64_t off_uj =
+        (uint64_t)(STANDBY_FRAME_INTERVAL_MS - awake_ms) * STANDBY_OFF_CURRENT_UA * STANDBY_SUPPLY_MV / 1000000;
+    uint64_t current_ua = (awake_uj + off_uj) * 1000000 / ((uint64_t)STANDBY_FRAME_INTERVAL_MS * STANDBY_SUPPLY_MV);
+    printf("Standby: awake %u ms (%u uJ) every %u ms, average current %u uA (estimate)\r\n", (unsigned)awake_ms,
+           (unsigned)awake_uj, (unsigned)STANDBY_FRAME_INTERVAL_MS, (unsigned)current_ua);
+}
+
+bool standby_frame_done(void) {
+    uint32_t elapsed_ms = (uint32_t)(clock() - wake_time) * 1000 / CLOCKS_PER_SEC;
+
+    if (!first_frame_done) {
+        first_frame_done = true;
+        if (wake_reason == STANDBY_WAKE_TIMER) {
+            state->wakeups++;
+            state->resume_ms += elapsed_ms;
+            printf("Standby: wake-up %u, resume to first frame %u ms (average %u ms)\r\n", (unsigned)state->wakeups,
+                   (unsigned)elapsed_ms, (unsigned)(state->resume_ms / state->wakeups));
+        } else {
+            printf("Standby: %s to first frame %u ms\r\n",
+                   wake_reason == STANDBY_WAKE_BUTTON ? "resume" : "boot", (unsigned)elapsed_ms);
+        }
+    }
+
+    // One frame per timer wake-up, a limited time of full rate otherwise
+    return wake_reason == STANDBY_WAKE_TIMER || elapsed_ms >= STANDBY_FULL_RATE_S * 1000;
+}
+
+void standby_enter(void) {
+    if (wake_reason == STANDBY_WAKE_TIMER) {
+        // The frame stages are modeled, the rest of the awake time is taken at their average power
+        uint32_t awake_ms = (uint32_t)(clock() - wake_time) * 1000 / CLOCKS_PER_SEC;
+        state->awake_ms += awake_ms;
+        state->awake_uj += (uint32_t)(energy_model_average_power_uw() * awake_ms / 1000.0f);
+        print_average_current();
+    } else {
+        state->magic = STANDBY_STATE_MAGIC;
+        state->wakeups = 0;
+        state->awake_ms = 0;
+        state->resume_ms = 0;
+        state->awake_uj = 0;
+        printf("Standby: entering, one frame every %u ms\r\n", (unsigned)STANDBY_FRAME_INTERVAL_MS);
+    }
+
+    // Wake up sources of the off profile (WE_LPTIMER, WE_LPGPIO)
+    uint32_t count = (uint64_t)STANDBY_FRAME_INTERVAL_MS * LPTIMER_CLOCK_HZ / 1000;
+    lptimer->Initialize(LPTIMER_CHANNEL, NULL);
+    lptimer->PowerControl(LPTIMER_CHANNEL, ARM_POWER_FULL);
+    lptimer->Control(LPTIMER_CHANNEL, ARM_LPTIMER_SET_COUNT1, &count);
+    lptimer->Start(LPTIMER_CHANNEL);
+
+    uint32_t irq_config = ARM_GPIO_IRQ_POLARITY_LOW | ARM_GPIO_IRQ_EDGE_SENSITIVE_SINGLE;
+    wake_port->Control(STANDBY_WAKE_GPIO_PIN, ARM_GPIO_ENABLE_INTERRUPT, &irq_config);
+
+    // The SE applies the off profile once the subsystem has gone to sleep, the next run starts from reset
+    pm_core_enter_deep_sleep_request_subsys_off();
+
+    // Only reached if the off request was refused
+    printf("\r\nError: standby entry failed\r\n");
+    __BKPT(0);
+}
@@ -0,0 +1,45 @@
+/* Copyright (C) 2026 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#ifndef STANDBY_H_
+#define STANDBY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Duty-cycled standby viewfinder.
+ *
+ * In standby the subsystem is off with the SE off profile: camera, MIPI and
+ * CDC200 are powered down and only the backup SRAM keeps the standby state.
+ * The LPTIMER wakes the system every STANDBY_FRAME_INTERVAL_MS to capture and
+ * show a single frame, the wake-up button on LPGPIO resumes the full-rate
+ * viewfinder for STANDBY_FULL_RATE_S seconds. A timer wake-up skips what the
+ * single frame does not need: the SE off profile is still set, and there is
+ * no splash and no boot-time measurement or report of the pipeline.
+ */
+typedef enum {
+    STANDBY_WAKE_COLD_BOOT = 0,
+    STANDBY_WAKE_TIMER,
+    STANDBY_WAKE_BUTTON,
+} standby_wake_t;
+
+// Find out why the system is running, call before init_power_management()
+standby_wake_t standby_init(void);
+
+// Result of standby_init()
+standby_wake_t standby_wake_reason(void);
+
+// Call after every displayed frame, returns true when the system should go to standby now
+bool standby_frame_done(void);
+
+// Arm the wake-up sources and request the subsystem off state, does not return
+void standby_enter(void);
+
+#endif  // STANDBY_H_